@@ -0,0 +1,83 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    bench_clone.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Measures per-request overrides on a large base configuration: clone the
+ * base, apply a few writes to the clone, and read them back.
+ *
+ * Usage: bench_clone [number of keys]
+*/
+
+// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/datastore.hpp>
+
+using namespace tmns;
+
+/// Clones made per measurement
+constexpr int CLONES = 1000;
+
+/// Writes applied to each clone
+constexpr size_t OVERRIDES = 8;
+
+int main( int argc, char* argv[] ) {
+
+    const size_t key_count = argc > 1 ? std::stoul( argv[1] ) : 100000;
+
+    // Groups of 100 integers, three levels deep
+    fcs::Datastore base;
+    std::vector<std::string> paths;
+    for( size_t i = 0; i < key_count; ++i ) {
+        auto path = "service_" + std::to_string( i / 100 ) + ".settings.value_" + std::to_string( i % 100 );
+        auto result = base.insert_property( path, base.make_property<fcs::prop::Integer_Property>( "", static_cast<int64_t>( i ) ) );
+        if( !result ) {
+            std::cerr << "Failed to build tree: " << result.error().message() << std::endl;
+            return 1;
+        }
+        paths.push_back( path );
+    }
+
+    using Clock = std::chrono::steady_clock;
+    double clone_us = 0;
+    double write_us = 0;
+    int64_t checksum = 0;
+    for( int c = 0; c < CLONES; ++c ) {
+        const auto start = Clock::now();
+        auto request = base.clone();
+        const auto cloned = Clock::now();
+        for( size_t w = 0; w < OVERRIDES; ++w ) {
+            const auto& path = paths[( static_cast<size_t>( c ) * 7919 + w * 104729 ) % paths.size()];
+            if( !request.set<int64_t>( path, -1 ) ) {
+                std::cerr << "Override failed" << std::endl;
+                return 1;
+            }
+            checksum += request.get_or<int64_t>( path, 0 );
+        }
+        const auto written = Clock::now();
+        clone_us += std::chrono::duration<double, std::micro>( cloned - start ).count();
+        write_us += std::chrono::duration<double, std::micro>( written - cloned ).count();
+    }
+
+    std::cout << "keys:                " << key_count << std::endl;
+    std::cout << "clone:               " << clone_us / CLONES << " us" << std::endl;
+    std::cout << OVERRIDES << " overrides + reads: " << write_us / CLONES << " us" << std::endl;
+    std::cout << "base untouched:      " << ( base.get_or<int64_t>( paths.front(), -1 ) == 0 ? "yes" : "no" )
+              << " (checksum " << checksum << ")" << std::endl;
+    return 0;
+}
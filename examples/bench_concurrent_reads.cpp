@@ -0,0 +1,149 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    bench_concurrent_reads.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Measures read throughput of snapshot readers as the thread count grows,
+ * while a writer keeps publishing new versions.  Readers hold a shared_ptr
+ * to the snapshot, borrow it under an epoch pin, or refresh a thread-local view.
+ *
+ * Usage: bench_concurrent_reads [milliseconds per run]
+*/
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/datastore.hpp>
+
+using namespace tmns;
+
+/// Properties read per snapshot acquisition
+constexpr size_t READS_PER_SNAPSHOT = 64;
+
+/**
+ * Run readers for a fixed time and return the total number of reads
+ */
+template <typename Acquire>
+static uint64_t run_readers( Acquire&&                       acquire,
+                             const std::vector<std::string>& paths,
+                             size_t                          thread_count,
+                             std::chrono::milliseconds       duration )
+{
+    std::atomic<bool>     stop{ false };
+    std::atomic<uint64_t> total{ 0 };
+    std::atomic<int64_t>  checksum{ 0 };
+
+    std::vector<std::thread> readers;
+    for( size_t t = 0; t < thread_count; ++t ) {
+        readers.emplace_back( [&, t]() {
+            uint64_t reads = 0;
+            int64_t  sum   = 0;
+            size_t   next  = t * 7919;
+            while( !stop.load( std::memory_order_relaxed ) ) {
+                auto snapshot = acquire();
+                for( size_t i = 0; i < READS_PER_SNAPSHOT; ++i ) {
+                    sum += snapshot->template get_or<int64_t>( paths[next++ % paths.size()], 0 );
+                }
+                reads += READS_PER_SNAPSHOT;
+            }
+            total.fetch_add( reads, std::memory_order_relaxed );
+            checksum.fetch_add( sum, std::memory_order_relaxed );
+        } );
+    }
+
+    std::this_thread::sleep_for( duration );
+    stop.store( true, std::memory_order_relaxed );
+    for( auto& reader : readers ) {
+        reader.join();
+    }
+    return total.load();
+}
+
+int main( int argc, char* argv[] ) {
+
+    const auto duration = std::chrono::milliseconds( argc > 1 ? std::stoi( argv[1] ) : 1000 );
+
+    // 16 groups of 64 integers, three levels deep
+    fcs::Datastore datastore( fcs::Concurrency::SNAPSHOT );
+    std::vector<std::string> paths;
+    for( int group = 0; group < 16; ++group ) {
+        for( int item = 0; item < 64; ++item ) {
+            auto path = "service_" + std::to_string( group ) + ".settings.value_" + std::to_string( item );
+            auto result = datastore.insert_property( path, datastore.make_property<fcs::prop::Integer_Property>( "", item ) );
+            if( !result ) {
+                std::cerr << "Failed to build tree: " << result.error().message() << std::endl;
+                return 1;
+            }
+            paths.push_back( path );
+        }
+    }
+
+    // A background writer keeps publishing new snapshots
+    std::atomic<bool> stop_writer{ false };
+    std::atomic<uint64_t> writes{ 0 };
+    std::thread writer( [&]() {
+        int64_t value = 0;
+        while( !stop_writer.load( std::memory_order_relaxed ) ) {
+            auto result = datastore.set<int64_t>( paths[static_cast<size_t>( value ) % paths.size()], value );
+            if( result ) {
+                writes.fetch_add( 1, std::memory_order_relaxed );
+            }
+            ++value;
+            std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+        }
+    } );
+
+    const size_t max_threads = std::max<size_t>( 1, std::thread::hardware_concurrency() );
+    std::vector<size_t> thread_counts;
+    for( size_t count = 1; count < max_threads; count *= 2 ) {
+        thread_counts.push_back( count );
+    }
+    thread_counts.push_back( max_threads );
+
+    auto report = [&]( const std::string& name, auto&& acquire ) {
+        std::cout << name << std::endl;
+        std::cout << std::setw( 8 ) << "threads" << std::setw( 16 ) << "reads/sec" << std::setw( 12 ) << "speedup" << std::endl;
+        double baseline = 0;
+        for( auto count : thread_counts ) {
+            const auto reads = run_readers( acquire, paths, count, duration );
+            const auto rate  = static_cast<double>( reads ) / std::chrono::duration<double>( duration ).count();
+            if( baseline == 0 ) {
+                baseline = rate;
+            }
+            std::cout << std::setw( 8 ) << count
+                      << std::setw( 16 ) << std::fixed << std::setprecision( 0 ) << rate
+                      << std::setw( 12 ) << std::setprecision( 2 ) << rate / baseline << std::endl;
+        }
+    };
+
+    report( "shared_ptr snapshots", [&]() { return datastore.snapshot(); } );
+    report( "epoch-pinned snapshots", [&]() { return datastore.read(); } );
+    report( "thread-local views", [&]() {
+        thread_local auto view = datastore.local_view();
+        view.refresh();
+        return view.get();
+    } );
+
+    stop_writer.store( true, std::memory_order_relaxed );
+    writer.join();
+    std::cout << "writes published during the run: " << writes.load() << std::endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    bench_transactions.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Measures the time to reload every value in a snapshot-mode datastore, once
+ * with one `set` call per value and once with a single transaction.
+ *
+ * Usage: bench_transactions [reloads per run]
+*/
+
+// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/datastore.hpp>
+
+using namespace tmns;
+
+/**
+ * Time a number of reloads and return the mean in microseconds
+ */
+template <typename Reload>
+static double time_reloads( Reload&& reload, int count )
+{
+    const auto start = std::chrono::steady_clock::now();
+    for( int i = 0; i < count; ++i ) {
+        if( !reload( i ) ) {
+            std::cerr << "Reload failed" << std::endl;
+            return 0;
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>( elapsed ).count() / count;
+}
+
+int main( int argc, char* argv[] ) {
+
+    const int reloads = argc > 1 ? std::stoi( argv[1] ) : 20;
+
+    std::cout << std::setw( 10 ) << "values" << std::setw( 16 ) << "per-call us"
+              << std::setw( 16 ) << "batched us" << std::setw( 12 ) << "speedup" << std::endl;
+
+    for( int groups : { 4, 16, 64 } ) {
+
+        // Groups of 64 integers, three levels deep
+        fcs::Datastore datastore( fcs::Concurrency::SNAPSHOT );
+        std::vector<std::string> paths;
+        for( int group = 0; group < groups; ++group ) {
+            for( int item = 0; item < 64; ++item ) {
+                auto path = "service_" + std::to_string( group ) + ".settings.value_" + std::to_string( item );
+                auto result = datastore.insert_property( path, datastore.make_property<fcs::prop::Integer_Property>( "", item ) );
+                if( !result ) {
+                    std::cerr << "Failed to build tree: " << result.error().message() << std::endl;
+                    return 1;
+                }
+                paths.push_back( path );
+            }
+        }
+
+        const auto per_call = time_reloads( [&]( int reload ) {
+            for( size_t i = 0; i < paths.size(); ++i ) {
+                if( !datastore.set<int64_t>( paths[i], reload + static_cast<int64_t>( i ) ) ) {
+                    return false;
+                }
+            }
+            return true;
+        }, reloads );
+
+        const auto batched = time_reloads( [&]( int reload ) {
+            auto transaction = datastore.transaction();
+            for( size_t i = 0; i < paths.size(); ++i ) {
+                transaction.set<int64_t>( paths[i], reload + static_cast<int64_t>( i ) );
+            }
+            return transaction.commit().has_value();
+        }, reloads );
+
+        std::cout << std::setw( 10 ) << paths.size()
+                  << std::setw( 16 ) << std::fixed << std::setprecision( 1 ) << per_call
+                  << std::setw( 16 ) << batched
+                  << std::setw( 12 ) << std::setprecision( 2 ) << per_call / batched << std::endl;
+    }
+    return 0;
+}
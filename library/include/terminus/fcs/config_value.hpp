@@ -0,0 +1,102 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    config_value.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+// Project Libraries
+#include <terminus/fcs/prop/hot_slot.hpp>
+#include <terminus/fcs/prop/value_cell.hpp>
+
+namespace tmns::fcs {
+
+/**
+ * Handle that always holds the current value of one property.
+ *
+ * Obtained from `Datastore::watch<T>()`.  The datastore updates the handle after
+ * each write to the path is published, so reading it is one atomic load with no
+ * path lookup, and a write that fails or is rolled back is never seen.  Scalars
+ * are read from an atomic copy shared with `Datastore::hot<T>()`; strings and
+ * paths from a published immutable copy.  Watching does not change the property.
+ *
+ * The handle follows the path it was taken for.  If the property is removed or
+ * replaced by another type it keeps the last value.  An empty handle reads a
+ * default-constructed value.
+ */
+template <typename T>
+class Config_Value
+{
+    public:
+
+        using Storage = std::conditional_t<prop::is_hot_value_v<T>,
+                                           prop::Hot_Handle<T>,
+                                           std::shared_ptr<const prop::Value_Cell<T>>>;
+
+        /**
+         * Default constructor.  Creates an empty handle.
+         */
+        Config_Value() = default;
+
+        explicit Config_Value( Storage storage ) : m_storage( std::move( storage ) ) {}
+
+        /**
+         * Check if the handle is bound to a property
+         */
+        explicit operator bool() const { return static_cast<bool>( m_storage ); }
+
+        /**
+         * Get the current value
+         */
+        T get() const
+        {
+            if constexpr( prop::is_hot_value_v<T> ) {
+                return m_storage.load();
+            }
+            else {
+                return m_storage ? *m_storage->load() : T{};
+            }
+        }
+
+        /**
+         * Share the current value without copying it.  Strings and paths only.
+         */
+        std::shared_ptr<const T> share() const requires ( !prop::is_hot_value_v<T> )
+        {
+            return m_storage ? m_storage->load() : std::make_shared<const T>();
+        }
+
+        /**
+         * Get the number of times the value changed since it was first watched
+         */
+        uint64_t changes() const
+        {
+            if constexpr( prop::is_hot_value_v<T> ) {
+                return m_storage.changes();
+            }
+            else {
+                return m_storage ? m_storage->changes() : 0;
+            }
+        }
+
+    private:
+
+        Storage m_storage;
+
+}; // End of Config_Value class
+
+} // End of tmns::fcs namespace
@@ -15,22 +15,74 @@
 #pragma once
 
 // C++ Standard Libraries
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <variant>
 #include <vector>
 
 // Terminus Libraries
 #include <terminus/outcome/result.hpp>
 
 // Project Libraries
+#include <terminus/fcs/config_value.hpp>
+#include <terminus/fcs/notify/async_dispatcher.hpp>
+#include <terminus/fcs/notify/listener_registry.hpp>
+#include <terminus/fcs/path_handle.hpp>
+#include <terminus/fcs/path_index.hpp>
+#include <terminus/fcs/prop/hot_slot.hpp>
 #include <terminus/fcs/prop/object_property.hpp>
+#include <terminus/fcs/prop/property_arena.hpp>
+#include <terminus/fcs/prop/property_view.hpp>
+#include <terminus/fcs/prop/typed_property.hpp>
+#include <terminus/fcs/prop/value_cell.hpp>
 #include <terminus/fcs/schema/schema.hpp>
+#include <terminus/fcs/snapshot.hpp>
+#include <terminus/fcs/value.hpp>
 
 namespace tmns::fcs {
 
+/**
+ * How a Datastore may be shared between threads
+ */
+enum class Concurrency
+{
+    NONE,     ///< Single-threaded.  Writes modify nodes in place.
+    SNAPSHOT, ///< Writes copy the nodes they change and publish immutable snapshots.
+};
+
+/**
+ * One write of a bulk compare-and-set
+ */
+struct Versioned_Write
+{
+    std::string path;
+
+    /// Version the property must still have for the write to apply
+    uint64_t expected_version{ 0 };
+
+    Value value;
+};
+
 /**
  * Main datastore for managing property trees
+ *
+ * With `Concurrency::SNAPSHOT`, writers are serialized by a lock.  Each write
+ * copies the path from the root to the node it changes, leaving the rest of the
+ * tree shared, and atomically publishes the new root as a Snapshot.  Readers
+ * call `snapshot()` and read it without taking any lock.  The Datastore's own
+ * read methods take the writer lock.  Published nodes are shared by snapshots,
+ * so this mode hands them out only as const, through `read_property()`; modify
+ * them through the Datastore.
+ *
+ * A Datastore owns its listeners, dispatcher, writer lock and live handles, so
+ * it can be moved but not copied.  `clone()` makes an O(1) independent copy.
  */
 class Datastore {
 
@@ -46,25 +98,447 @@ class Datastore {
          */
         explicit Datastore(std::shared_ptr<prop::Object_Property> root);
 
-        // Core property operations
-        Result<void> set_property( const std::string& path, const std::any& value );
-        Result<std::shared_ptr<prop::Property>> get_property( const std::string& path ) const;
-        Result<void> remove_property( const std::string& path );
+        /**
+         * Constructor with a concurrency mode
+         */
+        explicit Datastore( Concurrency concurrency );
+
+        Datastore( Datastore&& ) = default;
+        Datastore& operator=( Datastore&& ) = default;
+
+        /// Not copyable; use clone(), which shares the tree instead of copying it
+        Datastore( const Datastore& ) = delete;
+        Datastore& operator=( const Datastore& ) = delete;
+
+        /**
+         * Get the concurrency mode
+         */
+        Concurrency get_concurrency() const { return m_publication ? Concurrency::SNAPSHOT : Concurrency::NONE; }
+
+        /**
+         * Get the latest published snapshot.  Does not block writers.
+         *
+         * @return nullptr unless the datastore uses Concurrency::SNAPSHOT
+         */
+        std::shared_ptr<const Snapshot> snapshot() const;
+
+        /**
+         * Borrow the latest published snapshot under an epoch pin.
+         *
+         * Cheaper than `snapshot()`: the reader only writes its own per-thread
+         * record.  Replaced snapshots are released once no guard can refer to them.
+         * Guards must not outlive the datastore.
+         *
+         * @return An empty guard unless the datastore uses Concurrency::SNAPSHOT
+         */
+        Snapshot_Guard read() const;
+
+        /**
+         * Per-thread cached snapshot.  Defined below.
+         */
+        class Local_View;
+
+        /**
+         * Create a cached snapshot for the calling thread.
+         *
+         * Keep one view per thread, for example as a worker member or a
+         * thread_local, and call `refresh()` before each batch of reads.  The
+         * view must not outlive the datastore.
+         *
+         * @return An empty view unless the datastore uses Concurrency::SNAPSHOT
+         */
+        Local_View local_view() const;
+
+        /**
+         * Create an independent datastore that shares this one's tree.  O(1).
+         *
+         * No nodes are copied up front.  From then on each datastore copies a node
+         * before its first write to it, so a write costs O(depth) and the other
+         * datastore never sees it.  The clone has the same concurrency mode and
+         * schemas but no listeners, and allocates its copies from its own arena.
+         *
+         * A snapshot-mode datastore is cloned from its latest snapshot and is
+         * otherwise unchanged.
+         *
+         * In Concurrency::NONE, cloning changes this datastore too, permanently: it
+         * also copies each shared node before its first write, so those writes cost
+         * O(depth) rather than O(1), and a property fetched from either datastore
+         * keeps its old value once that datastore writes the path.  Properties
+         * fetched from either must be treated as read-only afterwards.
+         *
+         * Hot and watched handles are not shared.  Each datastore updates only the
+         * handles taken from it.
+         */
+        Datastore clone();
+
+        /**
+         * Staged batch of writes.  Defined below.
+         */
+        class Transaction;
+
+        /**
+         * Start a batch of writes that is applied, validated and published as one.
+         *
+         * Nothing is applied until `commit()`.  Readers see either none of the batch
+         * or all of it, and listeners hear about each changed path once.
+         */
+        Transaction transaction();
+
+        /**
+         * Call back after each successful write to a matching path.
+         *
+         * Patterns are an exact path, a prefix such as `app.server.*` matching
+         * everything below it, or `**` matching every path.  Callbacks run on the
+         * writing thread after the write is published, and receive nullptr for a
+         * removed property.  Inserting, replacing or removing an object also calls
+         * the listeners below it, once each.  Lookup cost depends on the path depth
+         * and the listeners below it, not on the number of listeners or the size of
+         * the subtree.  `clear()`, `set_root()` and schema changes do not notify.
+         *
+         * @return INVALID_INPUT if the pattern is malformed
+         */
+        Result<notify::Listener_Id> add_change_listener( std::string_view pattern, notify::Change_Callback callback );
+
+        /**
+         * Remove a change listener
+         *
+         * @return False if the id is unknown
+         */
+        bool remove_change_listener( notify::Listener_Id id );
+
+        /**
+         * Deliver change events on a background thread instead of inside each write.
+         *
+         * Writers only post to a bounded queue.  Changes to the same path within one
+         * batch are coalesced, so listeners see the latest value.  Events posted
+         * while the queue is full are held aside, latest per path, and delivered
+         * with the next batch.  Calling it again replaces the dispatcher after
+         * delivering what is queued.
+         *
+         * @return NOT_SUPPORTED unless the datastore uses Concurrency::SNAPSHOT, whose
+         *         published properties are safe to read from the dispatcher thread
+         */
+        Result<void> enable_async_dispatch( size_t queue_capacity = 4096 );
+
+        /**
+         * Return to synchronous dispatch after delivering what is queued
+         */
+        void disable_async_dispatch();
+
+        /**
+         * Wait until every change made so far has reached the listeners.  No-op when
+         * dispatch is synchronous.  Must not be called from a listener.
+         */
+        void flush_notifications() const;
+
+        /**
+         * Get the queue depth and the posted, delivered, coalesced and overflowed counts.
+         * All zero when dispatch is synchronous.
+         */
+        notify::Dispatch_Stats dispatch_stats() const;
+
+        /**
+         * Keep the most recent published versions so that they can be checked out again.
+         *
+         * Versions share every subtree a write did not copy, so memory grows with
+         * the nodes each write changed rather than with the size of the tree.
+         *
+         * @param depth Number of versions to keep, including the current one.  Zero disables history.
+         * @return NOT_SUPPORTED unless the datastore uses Concurrency::SNAPSHOT
+         */
+        Result<void> enable_history( size_t depth = 64 );
+
+        /**
+         * Get the version of the latest published snapshot.  Zero unless the
+         * datastore uses Concurrency::SNAPSHOT.
+         */
+        uint64_t version() const;
+
+        /**
+         * Get the retained versions, oldest first.  The last one is current.
+         */
+        std::vector<std::shared_ptr<const Snapshot>> history() const;
+
+        /**
+         * Make a retained version's tree current again.
+         *
+         * The tree is swapped in and republished as a new version, so versions keep
+         * increasing and the ones in between stay in the history.  Listeners hear
+         * about each path that differs; subtrees shared by both trees are skipped.
+         * Hot and watch handles on those paths are updated once the tree is published.
+         *
+         * @return NOT_SUPPORTED if history is disabled, NOT_FOUND if the version is no longer retained
+         */
+        Result<void> checkout( uint64_t version );
+
+        /**
+         * Check out the version published `steps` publications before the current one.
+         *
+         * A rollback is itself a publication, so rolling back one step twice returns
+         * to where the first rollback started.
+         *
+         * @return NOT_SUPPORTED if history is disabled, OUT_OF_BOUNDS if fewer versions are retained
+         */
+        Result<void> rollback( size_t steps = 1 );
+
+        // Core property operations.  A property fetched with get_property() and then
+        // restructured directly, with add_property() or remove_property(), leaves the
+        // path index stale: reads walk the tree until the next datastore write
+        // rebuilds the index.
+        Result<void> set_property( std::string_view path, const std::any& value );
+
+        /**
+         * Get a property that may be modified in place
+         *
+         * @return NOT_SUPPORTED in Concurrency::SNAPSHOT, whose nodes are shared with
+         *         snapshots; use read_property() there
+         */
+        Result<std::shared_ptr<prop::Property>> get_property( std::string_view path ) const;
+
+        /**
+         * Get a read-only property.  In Concurrency::SNAPSHOT it comes from the
+         * latest snapshot without taking the writer lock, and keeps that snapshot
+         * alive while it is held.  An empty path reads the root.
+         *
+         * @return NOT_FOUND if the path is missing
+         */
+        Result<std::shared_ptr<const prop::Property>> read_property( std::string_view path ) const;
+
+        Result<void> remove_property( std::string_view path );
+
+        /**
+         * Set a scalar value.  The alternative must match the property type.
+         */
+        Result<void> set_scalar_value( std::string_view path, const Value& value );
+
+        /**
+         * Get a scalar value.  Does not throw.
+         */
+        Result<Value> get_scalar_value( std::string_view path ) const;
+
+        /**
+         * Get the version of a property.  Compare it with the version a value was
+         * read at to tell whether the value is stale.
+         *
+         * @return NOT_FOUND if the path is missing
+         */
+        Result<uint64_t> get_version( std::string_view path ) const;
+
+        /**
+         * Set a scalar value only if the property is still at the expected version.
+         *
+         * Read the value and version, compute the update without holding any lock,
+         * then retry from a fresh read if this returns false.
+         *
+         * @return True if the value was set, false if another write changed the property first.
+         *         NOT_FOUND if the path is missing, TYPE_MISMATCH if the value has another type.
+         */
+        Result<bool> compare_and_set( std::string_view path, uint64_t expected_version, const Value& value );
+
+        /**
+         * Apply several writes only if every property is still at its expected version.
+         *
+         * The versions are checked and the writes applied under one writer lock and
+         * published as one version, so either all of the writes apply or none do.
+         * The written properties are validated against their schemas, as in a
+         * Transaction.
+         *
+         * @return True if the writes were applied, false if any version had moved on.
+         *         The first validation error if a written value is invalid.
+         */
+        Result<bool> compare_and_set( const std::vector<Versioned_Write>& writes );
+
+        /**
+         * Get a typed value without copying the property pointer or going through std::any.
+         *
+         * String views stay valid until the property is set again or removed.
+         *
+         * @return NOT_FOUND if the path is missing, TYPE_MISMATCH if it holds another type
+         */
+        template <typename T>
+        Result<Read_Type<T>> get( std::string_view path ) const
+        {
+            auto guard = lock();
+            auto found = lookup( path );
+            return prop::read_typed_value<T>( found ? found->get() : nullptr, path );
+        }
+
+        /**
+         * Borrow a typed value.  Returns nullptr if the path is missing or holds another type.
+         *
+         * The pointer stays valid until the property is set again or removed.
+         */
+        template <typename T>
+        const T* try_get( std::string_view path ) const
+        {
+            auto guard = lock();
+            auto found = lookup( path );
+            return prop::typed_value_ptr<T>( found ? found->get() : nullptr );
+        }
+
+        /**
+         * Get a typed value, or the fallback if the path is missing or holds another type
+         */
+        template <typename T>
+        Read_Type<T> get_or( std::string_view path, Read_Type<T> fallback ) const
+        {
+            auto guard = lock();
+            auto found = lookup( path );
+            return prop::typed_value_or<T>( found ? found->get() : nullptr, fallback );
+        }
+
+        /**
+         * Set the value of an existing typed property
+         *
+         * @return NOT_FOUND if the path is missing, TYPE_MISMATCH if it holds another type
+         */
+        template <typename T>
+        Result<void> set( std::string_view path, const T& value )
+        {
+            Write_Scope scope( *this );
+            auto target = writable( path );
+            if( prop::typed_value_ptr<T>( target ) == nullptr ) {
+                return prop::read_typed_value<T>( target, path ).error();
+            }
+            return scope.finish( static_cast<prop::Typed_Property<T>*>( target )->set_typed_value( value ), path );
+        }
+
+        /**
+         * Get a lock-free read handle to an integer, float, double or boolean property.
+         *
+         * The handle loads a cache-line-aligned atomic copy of the value, with no
+         * tree walk or lock.  The datastore updates the copy after each write to
+         * the path is published, so handles only see committed values.  Writes go
+         * through the datastore as usual.  The property itself is not changed, and
+         * every handle taken for the same path shares one copy.
+         *
+         * The handle follows the path.  If the property is removed or replaced by
+         * another type, it keeps the last value.
+         *
+         * @return NOT_FOUND if the path is missing, TYPE_MISMATCH if it holds another type
+         */
+        template <typename T>
+            requires prop::is_hot_value_v<T>
+        Result<prop::Hot_Handle<T>> hot( std::string_view path )
+        {
+            auto guard = lock();
+            auto found = lookup( path );
+            auto value = prop::read_typed_value<T>( found ? found->get() : nullptr, path );
+            if( !value ) {
+                return value.error();
+            }
+            auto slot = live_value<prop::Hot_Slot<T>>( path, value.value() );
+            return outcome::ok<prop::Hot_Handle<T>>( prop::Hot_Handle<T>( std::move( slot ) ) );
+        }
+
+        /**
+         * Get a handle that always holds the current value of a property.
+         *
+         * Writes through the datastore update the handle once they are published, so
+         * reading it is one atomic load.  Integers, floats, doubles and booleans are
+         * read through the same atomic copy as hot().
+         *
+         * @return NOT_FOUND if the path is missing, TYPE_MISMATCH if it holds another type
+         */
+        template <typename T>
+        Result<Config_Value<T>> watch( std::string_view path )
+        {
+            if constexpr( prop::is_hot_value_v<T> ) {
+                auto handle = hot<T>( path );
+                if( !handle ) {
+                    return handle.error();
+                }
+                return outcome::ok<Config_Value<T>>( std::move( handle.value() ) );
+            }
+            else {
+                auto guard = lock();
+                auto found = lookup( path );
+                auto value = prop::read_typed_value<T>( found ? found->get() : nullptr, path );
+                if( !value ) {
+                    return value.error();
+                }
+                auto cell = live_value<prop::Value_Cell<T>>( path, T( value.value() ) );
+                return outcome::ok<Config_Value<T>>( std::move( cell ) );
+            }
+        }
+
+        /**
+         * Insert a property at a path, creating intermediate objects as needed.
+         *
+         * The property's key is set to the last path component.  An existing property
+         * at the path is replaced.
+         */
+        Result<void> insert_property( std::string_view path, std::shared_ptr<prop::Property> property );
+
+        /**
+         * Create a property node in this datastore's arena.
+         *
+         * Nodes may outlive the datastore; each one keeps its arena alive.
+         */
+        template <typename Property_Type, typename... Args>
+        std::shared_ptr<Property_Type> make_property( Args&&... args ) const
+        {
+            auto guard = lock();
+            return prop::make_node<Property_Type>( m_arena, std::forward<Args>( args )... );
+        }
+
+        /**
+         * Get the allocation statistics of the current arena
+         */
+        prop::Property_Arena::Stats arena_stats() const;
+
+        /**
+         * Tokenize a dotted path once for repeated lookups.
+         *
+         * The handle caches the resolved property and is only re-resolved after the
+         * tree changes shape, so the handle-based get/set do no allocation.
+         */
+        Path_Handle compile_path( std::string_view path ) const;
+
+        /**
+         * Set a property value through a pre-compiled path
+         */
+        Result<void> set_property( const Path_Handle& handle, const std::any& value );
+
+        /**
+         * Get a property through a pre-compiled path
+         *
+         * @return NOT_SUPPORTED in Concurrency::SNAPSHOT, as for get_property()
+         */
+        Result<std::shared_ptr<prop::Property>> get_property( const Path_Handle& handle ) const;
+
+        /**
+         * Borrow a property without copying its shared_ptr.  An empty path views the root.
+         *
+         * The view is valid until the property is set again, removed, or the datastore
+         * is cleared.  Concurrent readers should use `snapshot()` instead.
+         */
+        prop::Property_View view( std::string_view path ) const;
+
+        /**
+         * Borrow a property through a pre-compiled path
+         */
+        prop::Property_View view( const Path_Handle& handle ) const;
+
+        /**
+         * Borrow the root.  Walking from the root view only reads the tree.
+         */
+        prop::Property_View root_view() const;
 
         /**
          * Set the Schema for a property
          */
-        Result<void> set_schema( const std::string& path, std::optional<schema::Schema> schema );
+        Result<void> set_schema( std::string_view path, std::optional<schema::Schema> schema );
 
         /**
          * Get the Schema for a property
          */
-        Result<std::optional<schema::Schema>> get_schema( const std::string& path ) const;
+        Result<std::optional<schema::Schema>> get_schema( std::string_view path ) const;
 
         /**
          * Validate a property
          */
-        Result<void> validate_property( const std::string& path ) const;
+        Result<void> validate_property( std::string_view path ) const;
 
         /**
          * Validate the entire datastore
@@ -84,42 +558,561 @@ class Datastore {
         /**
          * List properties
          */
-        Result<std::vector<std::string>> list_properties( const std::string& base_path = "" ) const;
+        Result<std::vector<std::string>> list_properties( std::string_view base_path = "" ) const;
 
         /**
          * Check if a property exists
          */
-        Result<bool> has_property( const std::string& path ) const;
+        Result<bool> has_property( std::string_view path ) const;
 
         /**
          * Root access
          */
-        std::shared_ptr<prop::Object_Property> get_root() const { return m_root; }
+        std::shared_ptr<prop::Object_Property> get_root() const;
 
         /**
          * Set the root property
          */
-        void set_root(std::shared_ptr<prop::Object_Property> root) { m_root = root; }
+        void set_root(std::shared_ptr<prop::Object_Property> root);
 
         /**
-         * Clear the datastore
+         * Clear the datastore.  A fresh arena is started; the old one is released
+         * in bulk once no node still refers to it.
          */
         void clear();
 
         /**
-         * Get the size of the datastore
+         * Get the number of properties in the datastore.  O(1).
          */
         size_t size() const;
 
+        /**
+         * Get node counts by type, maximum depth and approximate bytes.  O(1).
+         *
+         * Counts exclude the root object; the byte total includes it.
+         */
+        prop::Subtree_Stats stats() const;
+
+        /**
+         * Get the content hash of the whole tree.  O(1).
+         *
+         * Datastores holding the same keys, types and values have the same hash,
+         * in any process, so comparing hashes tells whether two configurations differ.
+         */
+        uint64_t content_hash() const;
+
     private:
+
+        /// Takes every shard's writer lock for a consistent cut
+        friend class Sharded_Datastore;
+
+        /**
+         * Writer lock and published state of a Concurrency::SNAPSHOT datastore
+         */
+        struct Publication
+        {
+            /// Serializes writers and the Datastore's own readers
+            std::recursive_mutex mutex;
+
+            /**
+             * Hand the last snapshot to the epoch manager, since guards may still read it
+             */
+            ~Publication();
+
+            /// Latest published tree
+            std::atomic<std::shared_ptr<const Snapshot>> snapshot;
+
+            /// Raw pointer to the latest snapshot for epoch-pinned readers
+            std::atomic<const Snapshot*> current{ nullptr };
+
+            /// Edit token of the nodes the writer may still modify in place
+            uint64_t edit{ 0 };
+
+            /// Number of publications so far
+            uint64_t version{ 0 };
+
+            /// Version of the latest snapshot, checked by local views
+            std::atomic<uint64_t> latest_version{ 0 };
+
+            /// Recently published snapshots, oldest first, if history is enabled
+            std::deque<std::shared_ptr<const Snapshot>> history;
+
+            /// Number of snapshots to retain in the history
+            size_t history_depth{ 0 };
+        };
+
+        /**
+         * Nodes resolved by the previous write of the current edit.  Consecutive
+         * writes under a common prefix skip the shared part of the walk.
+         */
+        struct Write_Cursor
+        {
+            uint64_t edit{ 0 };
+            const prop::Property* root{ nullptr };
+
+            /// Canonical path of the previous write, and where each component ends in it
+            std::string path;
+            std::vector<size_t> ends;
+
+            /// Node reached after each component
+            std::vector<prop::Property*> nodes;
+
+            void reset()
+            {
+                edit = 0;
+                root = nullptr;
+                path.clear();
+                ends.clear();
+                nodes.clear();
+            }
+        };
+
+        /**
+         * Bookkeeping for the write in progress
+         */
+        struct Write_State
+        {
+            /// Number of nested Write_Scopes
+            size_t depth{ 0 };
+
+            /// Paths changed by nested writes, notified once the outer write publishes
+            std::vector<std::string> changed;
+
+            /// Copy-on-write edit token of a batch in Concurrency::NONE, zero otherwise
+            uint64_t batch_edit{ 0 };
+
+            /// Tree to restore if a batch in Concurrency::NONE fails
+            std::shared_ptr<prop::Object_Property> batch_base;
+
+            /// Copy-on-write edit token in Concurrency::NONE once the tree is shared with a clone, zero before
+            uint64_t shared_edit{ 0 };
+
+            Write_Cursor cursor;
+        };
+
+        /**
+         * Writer lock held for one write.
+         *
+         * Scopes nest.  The outermost one publishes when it finishes successfully and
+         * then notifies listeners of its own path and of every path changed by nested
+         * writes.  If it ends without succeeding, the tree is rolled back to the last
+         * published state, so failed writes in snapshot mode and failed batches in
+         * either mode change nothing.
+         */
+        class Write_Scope
+        {
+            public:
+
+                /**
+                 * Constructor
+                 *
+                 * @param batch Copy nodes on write even in Concurrency::NONE, so the outer write can be rolled back
+                 */
+                explicit Write_Scope( Datastore& datastore, bool batch = false )
+                    : m_datastore( datastore ),
+                      m_lock( datastore.lock() ),
+                      m_outer( datastore.m_write.depth++ == 0 )
+                {
+                    if( m_outer ) {
+                        m_datastore.sync_index();
+                    }
+                    if( m_outer && batch ) {
+                        m_datastore.begin_batch();
+                    }
+                }
+
+                ~Write_Scope()
+                {
+                    if( !m_ended ) {
+                        end();
+                    }
+                }
+
+                /**
+                 * Record the outcome of the write.  The outer scope publishes on success.
+                 *
+                 * @param changed_path Path whose listeners to notify.  Empty to notify nobody.
+                 */
+                Result<void> finish( Result<void> result, std::string_view changed_path = {} )
+                {
+                    m_succeeded = result.has_value();
+                    if( !m_outer ) {
+                        if( m_succeeded && !changed_path.empty() ) {
+                            m_datastore.m_write.changed.emplace_back( changed_path );
+                        }
+                        return result;
+                    }
+                    if( m_succeeded ) {
+                        m_datastore.publish();
+                        m_datastore.refresh_live_values( m_datastore.m_write.changed, changed_path );
+                    }
+
+                    // Listeners may write again, which starts a new outer scope
+                    auto changed = std::move( m_datastore.m_write.changed );
+                    end();
+                    if( m_succeeded ) {
+                        m_datastore.notify_changes( std::move( changed ), changed_path );
+                    }
+                    return result;
+                }
+
+                Write_Scope( const Write_Scope& ) = delete;
+                Write_Scope& operator=( const Write_Scope& ) = delete;
+
+            private:
+
+                void end()
+                {
+                    m_ended = true;
+                    --m_datastore.m_write.depth;
+                    if( m_outer ) {
+                        if( !m_succeeded ) {
+                            m_datastore.discard();
+                        }
+                        m_datastore.end_batch();
+                    }
+                }
+
+                Datastore& m_datastore;
+                std::unique_lock<std::recursive_mutex> m_lock;
+                bool m_outer;
+                bool m_succeeded{ false };
+                bool m_ended{ false };
+
+        }; // End of Write_Scope class
+
+        /// Publication state; null unless the datastore uses Concurrency::SNAPSHOT
+        std::unique_ptr<Publication> m_publication;
+
+        Write_State m_write;
+
+        /**
+         * Copy of a property's value handed out by hot() and watch()
+         */
+        using Live_Value = std::variant<std::shared_ptr<prop::Hot_Slot<int64_t>>,
+                                        std::shared_ptr<prop::Hot_Slot<float>>,
+                                        std::shared_ptr<prop::Hot_Slot<double>>,
+                                        std::shared_ptr<prop::Hot_Slot<bool>>,
+                                        std::shared_ptr<prop::Value_Cell<std::string>>,
+                                        std::shared_ptr<prop::Value_Cell<std::filesystem::path>>>;
+
+        /// Live values by canonical path.  Sorted so that a subtree's entries are adjacent.
+        std::map<std::string, Live_Value, std::less<>> m_live;
+
+        /// Change listeners.  Held by pointer so the datastore stays movable.
+        std::unique_ptr<notify::Listener_Registry> m_listeners{ std::make_unique<notify::Listener_Registry>() };
+
+        /// Arena that nodes created by this datastore are allocated from
+        std::shared_ptr<prop::Property_Arena> m_arena;
+
         std::shared_ptr<prop::Object_Property> m_root;
 
+        /// Full-path index over the whole tree, kept by the write paths only so that
+        /// const reads never modify it.  Reads walk the tree while it is stale.
+        Path_Index m_index;
+
+        /// Root structure generation the index was last built or updated against
+        uint64_t m_index_generation{ 0 };
+
+        /// Background dispatcher, if enabled.  Declared last so it drains before the tree is
+        /// destroyed, and shared so it can be flushed without the writer lock.
+        std::shared_ptr<notify::Async_Dispatcher> m_dispatcher;
+
         // Helper methods
         std::pair<std::string, std::string> parse_key_value( const std::string& input ) const;
         Result<std::shared_ptr<prop::Property>> create_property_for_value( const std::string& key, const std::string& value ) const;
         std::shared_ptr<prop::Property> infer_property_from_string( const std::string& key, const std::string& value ) const;
-        std::vector<std::string> split_path( const std::string& path ) const;
+
+        /**
+         * Find the stored pointer for a path, through the index while it is current
+         * and then the tree.  Never modifies the index, so concurrent const readers
+         * are safe.  Does not touch reference counts on a hit.  Returns nullptr if missing.
+         */
+        const std::shared_ptr<prop::Property>* lookup( std::string_view path ) const;
+
+        /**
+         * Get a property in either concurrency mode, for the Datastore's own reads
+         * and writes.  get_property() adds the SNAPSHOT-mode check on top.
+         */
+        Result<std::shared_ptr<prop::Property>> find_property( std::string_view path ) const;
+        Result<std::shared_ptr<prop::Property>> find_property( const Path_Handle& handle ) const;
+
+        /**
+         * Join the components of a path with single dots
+         */
+        static std::string canonical_path( std::string_view path );
+
+        /**
+         * Get the live value for a path, creating it from the current value if needed
+         */
+        template <typename Live_Type, typename T>
+        std::shared_ptr<Live_Type> live_value( std::string_view path, const T& value )
+        {
+            auto& entry = m_live[canonical_path( path )];
+            if( auto existing = std::get_if<std::shared_ptr<Live_Type>>( &entry ); existing != nullptr && *existing ) {
+                return *existing;
+            }
+            auto created = std::make_shared<Live_Type>( value );
+            entry = created;
+            return created;
+        }
+
+        /**
+         * Copy the published values of every changed path, and of everything below
+         * it, into the live values.  Entries no handle refers to any more are dropped.
+         */
+        void refresh_live_values( const std::vector<std::string>& changed, std::string_view path );
+
+        /**
+         * Refresh the live values at and below one path.  An empty path refreshes all of them.
+         */
+        void refresh_live_subtree( std::string_view path );
+
+        /**
+         * Take the writer lock.  The returned lock is empty unless in snapshot mode.
+         */
+        std::unique_lock<std::recursive_mutex> lock() const;
+
+        /**
+         * Get the root for writing.  In snapshot mode a published root is copied first.
+         */
+        prop::Object_Property* writable_root();
+
+        /**
+         * Find a property for writing.  In snapshot mode every published node on the
+         * path is copied first.  Returns nullptr if missing or the path is empty.
+         */
+        prop::Property* writable( std::string_view path );
+
+        /**
+         * Get the edit token that write methods copy nodes for, or zero to modify in place
+         */
+        uint64_t write_edit() const
+        {
+            if( m_publication ) {
+                return m_publication->edit;
+            }
+            return m_write.batch_edit != 0 ? m_write.batch_edit : m_write.shared_edit;
+        }
+
+        /**
+         * Start copying nodes on write in Concurrency::NONE, remembering the tree to restore
+         */
+        void begin_batch();
+
+        /**
+         * Forget the batch state once the outer write has published or rolled back
+         */
+        void end_batch();
+
+        /**
+         * Check that a compare-and-set can apply to a property.  Requires the writer lock.
+         *
+         * @return True if the property is at the expected version
+         */
+        Result<bool> check_version( std::string_view path, uint64_t expected_version, const Value& value ) const;
+
+        /**
+         * Validate each property changed by the write in progress once.  Requires the writer lock.
+         */
+        Result<void> validate_changed() const;
+
+        /**
+         * Invoke the listeners matching a changed path
+         */
+        void notify_change( std::string_view path );
+
+        /**
+         * Notify each distinct path once
+         */
+        void notify_changes( std::vector<std::string> changed, std::string_view path );
+
+        /**
+         * Return to the last published tree after a failed write.  No-op unless in snapshot mode.
+         */
+        void discard();
+
+        /**
+         * Publish the tree if a write changed it, retiring the previous snapshot.
+         * No-op unless in snapshot mode.
+         */
+        void publish();
+
+        /**
+         * Check whether the index matches the current tree structure
+         */
+        bool index_current() const { return m_index_generation == m_root->get_structure_generation(); }
+
+        /**
+         * Rebuild the index if the tree was swapped or restructured outside of the
+         * Datastore since it was last updated.  O(n) then, O(1) otherwise.  Write paths only.
+         */
+        void sync_index();
+
+        /**
+         * Record that the index reflects the current tree structure
+         */
+        void commit_index();
+
+        /**
+         * Add or remove index entries for a property and its object descendants
+         */
+        void index_subtree( std::string& path, const std::shared_ptr<prop::Property>& property );
+        void unindex_subtree( std::string& path, const prop::Property& property );
 
 }; // End of Datastore class
 
+/**
+ * Snapshot cached by one thread.
+ *
+ * `refresh()` compares the cached snapshot's version with the datastore's
+ * latest version, one relaxed load, and reacquires only when they differ.
+ * Between refreshes, reads are plain memory loads into an immutable tree.
+ * A view is not safe to share between threads.
+ */
+class Datastore::Local_View
+{
+    public:
+
+        /**
+         * Default constructor.  Creates an empty view.
+         */
+        Local_View() = default;
+
+        /**
+         * Pick up the latest snapshot if a newer one was published
+         *
+         * @return True if the cached snapshot changed
+         */
+        bool refresh()
+        {
+            if( m_publication == nullptr ||
+                m_publication->latest_version.load( std::memory_order_relaxed ) == m_snapshot->version() )
+            {
+                return false;
+            }
+            m_snapshot = m_publication->snapshot.load( std::memory_order_acquire );
+            return true;
+        }
+
+        /**
+         * Check if the view refers to a snapshot
+         */
+        explicit operator bool() const { return m_snapshot != nullptr; }
+
+        const Snapshot& operator*() const { return *m_snapshot; }
+
+        const Snapshot* operator->() const { return m_snapshot.get(); }
+
+        const Snapshot* get() const { return m_snapshot.get(); }
+
+    private:
+
+        friend class Datastore;
+
+        explicit Local_View( const Publication* publication )
+            : m_publication( publication ),
+              m_snapshot( publication->snapshot.load( std::memory_order_acquire ) ) {}
+
+        const Publication* m_publication{ nullptr };
+
+        std::shared_ptr<const Snapshot> m_snapshot;
+
+}; // End of Local_View class
+
+/**
+ * Batch of writes applied to a Datastore as one.
+ *
+ * `commit()` takes the writer lock once and applies the staged writes in order.
+ * Consecutive writes under a common prefix share the walk from the root.  The
+ * changed properties are then validated once, the result is published as a
+ * single version, and listeners are notified once per changed path.  If any
+ * write or validation fails, nothing is applied.  Hot and watch handles are
+ * only updated after the batch publishes, so they never see a rejected write.
+ *
+ * In Concurrency::NONE the batch copies the nodes it changes, as snapshot mode
+ * does, so that it can be rolled back.  Properties fetched before the commit
+ * keep their old values.
+ */
+class Datastore::Transaction
+{
+    public:
+
+        /**
+         * Stage a typed value for an existing property
+         */
+        template <typename T>
+        Transaction& set( std::string_view path, const T& value )
+        {
+            return set_scalar_value( path, Value( std::in_place_type<T>, value ) );
+        }
+
+        /**
+         * Stage a scalar value for an existing property
+         */
+        Transaction& set_scalar_value( std::string_view path, const Value& value )
+        {
+            m_operations.push_back( Operation{ std::string( path ), value } );
+            return *this;
+        }
+
+        /**
+         * Stage a std::any value for an existing property
+         */
+        Transaction& set_property( std::string_view path, const std::any& value )
+        {
+            m_operations.push_back( Operation{ std::string( path ), value } );
+            return *this;
+        }
+
+        /**
+         * Stage an insertion, creating intermediate objects as needed
+         */
+        Transaction& insert_property( std::string_view path, std::shared_ptr<prop::Property> property )
+        {
+            m_operations.push_back( Operation{ std::string( path ), std::move( property ) } );
+            return *this;
+        }
+
+        /**
+         * Stage a removal
+         */
+        Transaction& remove_property( std::string_view path )
+        {
+            m_operations.push_back( Operation{ std::string( path ), std::monostate() } );
+            return *this;
+        }
+
+        /**
+         * Get the number of staged writes
+         */
+        size_t size() const { return m_operations.size(); }
+
+        /**
+         * Apply every staged write, or none of them.  The transaction is empty afterwards.
+         *
+         * @return The first failed write or validation
+         */
+        Result<void> commit();
+
+    private:
+
+        friend class Datastore;
+
+        struct Operation
+        {
+            std::string path;
+
+            /// Removal, scalar value, std::any value or inserted property
+            std::variant<std::monostate, Value, std::any, std::shared_ptr<prop::Property>> payload;
+        };
+
+        explicit Transaction( Datastore& datastore ) : m_datastore( datastore ) {}
+
+        Datastore& m_datastore;
+
+        std::vector<Operation> m_operations;
+
+}; // End of Transaction class
+
 } // namespace tmns::fcs
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    diff.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project Libraries
+#include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/prop/property.hpp>
+#include <terminus/fcs/snapshot.hpp>
+#include <terminus/fcs/value.hpp>
+
+namespace tmns::fcs {
+
+/**
+ * How a path differs between two trees
+ */
+enum class Change_Kind
+{
+    ADDED,    ///< Only in the newer tree
+    REMOVED,  ///< Only in the older tree
+    MODIFIED, ///< In both, with a different value or type
+};
+
+/**
+ * One difference between two trees
+ */
+struct Property_Change
+{
+    Change_Kind kind;
+
+    std::string path;
+
+    /// Value in the older tree.  Empty if the path was added or holds a container.
+    std::optional<Value> old_value;
+
+    /// Value in the newer tree.  Empty if the path was removed or holds a container.
+    std::optional<Value> new_value;
+};
+
+/**
+ * Callback for each difference found by diff_trees().  The properties are null
+ * on the side where the path does not exist, and are only valid during the call.
+ */
+using Change_Visitor = std::function<void( Change_Kind           kind,
+                                           std::string_view      path,
+                                           const prop::Property* before,
+                                           const prop::Property* after )>;
+
+/**
+ * Visit every difference between two trees.
+ *
+ * Subtrees that are shared by both trees, or that have equal content hashes,
+ * are skipped without being visited, so the cost follows the size of the
+ * change rather than the size of the trees.  An added or removed subtree is
+ * reported once, at its top.  A leaf whose value changed, an array whose items
+ * changed, or a path whose type changed is reported as MODIFIED.
+ */
+void diff_trees( const prop::Property& before, const prop::Property& after, const Change_Visitor& visit );
+
+/**
+ * List the differences between two property trees, in path order
+ */
+std::vector<Property_Change> diff( const prop::Property& before, const prop::Property& after );
+
+/**
+ * List the differences between two snapshots, in path order
+ */
+std::vector<Property_Change> diff( const Snapshot& before, const Snapshot& after );
+
+/**
+ * List the differences between two datastores, in path order.
+ *
+ * Snapshot-mode datastores are compared at their latest snapshots, so writers
+ * are not blocked.  A datastore in Concurrency::NONE must not be written
+ * during the call.
+ */
+std::vector<Property_Change> diff( const Datastore& before, const Datastore& after );
+
+} // End of tmns::fcs namespace
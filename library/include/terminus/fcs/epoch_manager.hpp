@@ -0,0 +1,174 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    epoch_manager.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace tmns::fcs {
+
+/**
+ * Epoch-based reclamation shared by every concurrent Datastore in the process.
+ *
+ * A reader pins the current epoch before it loads a pointer to shared data
+ * and unpins when done.  Pinning writes only to a record owned by the calling
+ * thread, on its own cache line, so readers never contend with each other.
+ * Writers retire replaced objects instead of releasing them.  A retired object
+ * is released once every pinned reader has entered a later epoch.
+ */
+class Epoch_Manager
+{
+    private:
+
+        /**
+         * Per-thread reader state.  Records are reused after their thread exits.
+         */
+        struct alignas( 64 ) Reader_Record
+        {
+            /// Epoch the thread pinned, or zero when it is not reading
+            std::atomic<uint64_t> epoch{ 0 };
+
+            /// Set while a thread owns the record
+            std::atomic<bool> claimed{ false };
+
+            /// Pin nesting depth.  Only touched by the owning thread.
+            uint32_t depth{ 0 };
+
+            Reader_Record* next{ nullptr };
+        };
+
+    public:
+
+        /**
+         * Keeps the calling thread pinned.  Must be released on the thread that created it.
+         */
+        class Guard
+        {
+            public:
+
+                Guard() = default;
+
+                Guard( Guard&& other ) noexcept
+                    : m_record( std::exchange( other.m_record, nullptr ) ) {}
+
+                Guard& operator=( Guard&& other ) noexcept
+                {
+                    if( this != &other ) {
+                        release();
+                        m_record = std::exchange( other.m_record, nullptr );
+                    }
+                    return *this;
+                }
+
+                ~Guard() { release(); }
+
+                /**
+                 * Check if the guard holds a pin
+                 */
+                explicit operator bool() const { return m_record != nullptr; }
+
+            private:
+
+                friend class Epoch_Manager;
+
+                explicit Guard( Reader_Record* record ) : m_record( record ) {}
+
+                void release()
+                {
+                    if( m_record != nullptr && --m_record->depth == 0 ) {
+                        m_record->epoch.store( 0, std::memory_order_release );
+                    }
+                    m_record = nullptr;
+                }
+
+                Reader_Record* m_record{ nullptr };
+
+        }; // End of Guard class
+
+        /**
+         * Get the process-wide manager
+         */
+        static Epoch_Manager& instance();
+
+        /**
+         * Pin the current epoch for the calling thread.  Pins nest.
+         */
+        Guard pin();
+
+        /**
+         * Hand over an object that readers may still be using.  It is released by
+         * a later `reclaim()` once no reader can hold it.
+         */
+        void retire( std::shared_ptr<const void> object );
+
+        /**
+         * Release every retired object that no pinned reader can still hold
+         *
+         * @return Number of objects released
+         */
+        size_t reclaim();
+
+        /**
+         * Get the number of retired objects not yet released
+         */
+        size_t pending() const;
+
+        /**
+         * Get the current epoch
+         */
+        uint64_t epoch() const { return m_epoch.load( std::memory_order_acquire ); }
+
+        Epoch_Manager( const Epoch_Manager& ) = delete;
+        Epoch_Manager& operator=( const Epoch_Manager& ) = delete;
+
+    private:
+
+        struct Retired
+        {
+            std::shared_ptr<const void> object;
+
+            /// Epoch before the object was retired; readers pinned at or before it may hold it
+            uint64_t epoch{ 0 };
+        };
+
+        Epoch_Manager() = default;
+
+        /**
+         * Get the calling thread's record, claiming one on first use
+         */
+        Reader_Record* local_record();
+
+        /**
+         * Get the oldest epoch pinned by any reader, or UINT64_MAX if none
+         */
+        uint64_t oldest_pinned_epoch() const;
+
+        std::atomic<uint64_t> m_epoch{ 1 };
+
+        /// Every record ever allocated.  Records are never freed.
+        std::atomic<Reader_Record*> m_records{ nullptr };
+
+        std::vector<Retired> m_retired;
+
+        mutable std::mutex m_retired_mutex;
+
+}; // End of Epoch_Manager class
+
+} // End of tmns::fcs namespace
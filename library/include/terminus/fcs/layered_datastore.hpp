@@ -0,0 +1,207 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    layered_datastore.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/result.hpp>
+
+// Project Libraries
+#include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/snapshot.hpp>
+#include <terminus/fcs/value.hpp>
+
+namespace tmns::fcs {
+
+/**
+ * Stack of read-only configuration layers, such as defaults, file, environment,
+ * command line and runtime overrides.
+ *
+ * A read returns the property from the topmost layer that has the path.  Layers
+ * are never merged or copied; each resolved path is cached, and every change to
+ * the stack invalidates the whole cache in O(1), so pushing an override layer
+ * or dropping it again takes effect on the next read.
+ *
+ * Layers are not merged below the leaves: reading an object returns the
+ * topmost layer's object alone.  Safe to use from several threads.  String
+ * views are valid while the layer they came from stays in the stack.
+ */
+class Layered_Datastore
+{
+    public:
+
+        /**
+         * Constructor
+         */
+        Layered_Datastore() = default;
+
+        Layered_Datastore( const Layered_Datastore& ) = delete;
+        Layered_Datastore& operator=( const Layered_Datastore& ) = delete;
+
+        /**
+         * Push a layer above all others
+         *
+         * @return INVALID_INPUT if the snapshot is null or the name is taken
+         */
+        Result<void> push_layer( std::string name, std::shared_ptr<const Snapshot> layer );
+
+        /**
+         * Push a datastore's tree as a layer above all others.  The datastore is
+         * consumed, so nothing else can write to the layer.
+         *
+         * @return INVALID_INPUT if the name is taken
+         */
+        Result<void> push_layer( std::string name, Datastore layer );
+
+        /**
+         * Remove the topmost layer
+         *
+         * @return NOT_FOUND if there are no layers
+         */
+        Result<void> pop_layer();
+
+        /**
+         * Remove a layer by name
+         *
+         * @return NOT_FOUND if no layer has the name
+         */
+        Result<void> remove_layer( std::string_view name );
+
+        /**
+         * Replace a layer in place, keeping its position, for example after reloading a file
+         *
+         * @return NOT_FOUND if no layer has the name, INVALID_INPUT if the snapshot is null
+         */
+        Result<void> replace_layer( std::string_view name, std::shared_ptr<const Snapshot> layer );
+
+        /**
+         * Get a layer by name
+         *
+         * @return NOT_FOUND if no layer has the name
+         */
+        Result<std::shared_ptr<const Snapshot>> get_layer( std::string_view name ) const;
+
+        /**
+         * Get the layer names, bottom first
+         */
+        std::vector<std::string> layer_names() const;
+
+        size_t layer_count() const;
+
+        /**
+         * Get a typed value from the topmost layer that has the path
+         *
+         * @return NOT_FOUND if no layer has the path, TYPE_MISMATCH if it holds another type
+         */
+        template <typename T>
+        Result<Read_Type<T>> get( std::string_view path ) const
+        {
+            std::lock_guard<std::mutex> guard( m_mutex );
+            return prop::read_typed_value<T>( resolve( path ).property, path );
+        }
+
+        /**
+         * Get a typed value, or the fallback if no layer has the path or it holds another type
+         */
+        template <typename T>
+        Read_Type<T> get_or( std::string_view path, Read_Type<T> fallback ) const
+        {
+            std::lock_guard<std::mutex> guard( m_mutex );
+            return prop::typed_value_or<T>( resolve( path ).property, fallback );
+        }
+
+        /**
+         * Get a scalar value from the topmost layer that has the path
+         */
+        Result<Value> get_scalar_value( std::string_view path ) const;
+
+        /**
+         * Check if any layer has a path
+         */
+        bool has_property( std::string_view path ) const;
+
+        /**
+         * Get the name of the layer a path resolves to
+         *
+         * @return NOT_FOUND if no layer has the path
+         */
+        Result<std::string> get_source( std::string_view path ) const;
+
+    private:
+
+        struct Layer
+        {
+            std::string name;
+
+            std::shared_ptr<const Snapshot> snapshot;
+        };
+
+        /**
+         * Resolved path.  Valid while the generation matches the stack's.
+         */
+        struct Resolution
+        {
+            uint64_t generation{ 0 };
+
+            const prop::Property* property{ nullptr };
+
+            size_t layer{ 0 };
+        };
+
+        /**
+         * Hash that lets the cache be probed with a string_view
+         */
+        struct Path_Hash
+        {
+            using is_transparent = void;
+
+            size_t operator()( std::string_view path ) const { return std::hash<std::string_view>{}( path ); }
+        };
+
+        /**
+         * Find the topmost property at a path, probing the layers on a cache miss.  Requires the mutex.
+         */
+        const Resolution& resolve( std::string_view path ) const;
+
+        /**
+         * Find a layer's position by name.  Requires the mutex.
+         */
+        std::vector<Layer>::iterator find_layer( std::string_view name );
+
+        /**
+         * Invalidate every cached resolution.  Requires the mutex.
+         */
+        void invalidate();
+
+        mutable std::mutex m_mutex;
+
+        std::vector<Layer> m_layers;
+
+        uint64_t m_generation{ 1 };
+
+        mutable std::unordered_map<std::string, Resolution, Path_Hash, std::equal_to<>> m_cache;
+
+}; // End of Layered_Datastore class
+
+} // End of tmns::fcs namespace
@@ -0,0 +1,164 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    async_dispatcher.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Project Libraries
+#include <terminus/fcs/notify/bounded_queue.hpp>
+#include <terminus/fcs/notify/listener_registry.hpp>
+#include <terminus/fcs/prop/property.hpp>
+
+namespace tmns::fcs::notify {
+
+/**
+ * Counters of an Async_Dispatcher
+ */
+struct Dispatch_Stats
+{
+    /// Events waiting in the queue
+    size_t queue_depth{ 0 };
+
+    /// Events accepted into the queue
+    uint64_t posted{ 0 };
+
+    /// Events handed to listeners
+    uint64_t delivered{ 0 };
+
+    /// Events superseded by a later change to the same path in the same batch
+    uint64_t coalesced{ 0 };
+
+    /// Events that found the queue full and were held aside, latest per path
+    uint64_t overflowed{ 0 };
+};
+
+/**
+ * Delivers change events to listeners on a background thread.
+ *
+ * Writers post events into a bounded lock-free queue and never wait for
+ * listeners.  The dispatcher thread drains everything queued as one batch.
+ * Within a batch only the last event for each path is delivered, so listeners
+ * see the latest value.  When the queue is full, writers hold the event aside
+ * in a small overflow map under a mutex instead.  The map keeps only the
+ * latest event per path, and it joins the next batch, so no path loses its
+ * final value.
+ */
+class Async_Dispatcher
+{
+    public:
+
+        /**
+         * Constructor.  Starts the dispatcher thread.
+         *
+         * @param registry Listeners to deliver to.  Must outlive the dispatcher.
+         * @param capacity Queue capacity, rounded up to a power of two
+         */
+        Async_Dispatcher( const Listener_Registry& registry, size_t capacity );
+
+        /**
+         * Destructor.  Delivers the events already queued, then stops the thread.
+         */
+        ~Async_Dispatcher();
+
+        /**
+         * Queue a change.  The property must no longer be modified.
+         *
+         * @return False if the queue was full and the event was held in the overflow
+         */
+        bool post( std::string path, std::shared_ptr<const prop::Property> property );
+
+        /**
+         * Wait until every event posted before the call has been delivered or
+         * coalesced.  Must not be called from a listener.
+         */
+        void flush();
+
+        /**
+         * Get the queue depth and event counters
+         */
+        Dispatch_Stats stats() const;
+
+        Async_Dispatcher( const Async_Dispatcher& ) = delete;
+        Async_Dispatcher& operator=( const Async_Dispatcher& ) = delete;
+
+    private:
+
+        struct Event
+        {
+            std::string                          path;
+            std::shared_ptr<const prop::Property> property;
+
+            /// Post order, so an overflowed event never supersedes a later one
+            uint64_t sequence{ 0 };
+        };
+
+        /**
+         * Dispatcher thread loop
+         */
+        void run();
+
+        /**
+         * Move the overflowed events into a batch
+         *
+         * @return Number of events posted to the overflow, including superseded ones
+         */
+        size_t take_overflow( std::vector<Event>& batch );
+
+        /**
+         * Deliver one batch, keeping only the latest event per path
+         *
+         * @param events Number of posted events the batch stands for
+         */
+        void deliver( std::vector<Event>& batch, size_t events );
+
+        const Listener_Registry& m_registry;
+
+        Bounded_Queue<Event> m_queue;
+
+        std::atomic<uint64_t> m_sequence{ 0 };
+        std::atomic<uint64_t> m_posted{ 0 };
+        std::atomic<uint64_t> m_overflowed{ 0 };
+        std::atomic<uint64_t> m_delivered{ 0 };
+        std::atomic<uint64_t> m_coalesced{ 0 };
+
+        /// Events taken off the queue and fully handled.  flush() waits on it.
+        std::atomic<uint64_t> m_consumed{ 0 };
+
+        /// Bumped on every post and on shutdown.  The thread waits on it when idle.
+        std::atomic<uint64_t> m_signal{ 0 };
+
+        std::atomic<bool> m_stop{ false };
+
+        /// Latest event per path that found the queue full
+        std::unordered_map<std::string, Event> m_overflow;
+
+        /// Events posted to the overflow since it was last taken.  Guarded by the mutex; read unlocked as a hint.
+        std::atomic<size_t> m_overflow_pending{ 0 };
+
+        std::mutex m_overflow_mutex;
+
+        std::thread m_thread;
+
+}; // End of Async_Dispatcher class
+
+} // End of tmns::fcs::notify namespace
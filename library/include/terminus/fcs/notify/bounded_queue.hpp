@@ -0,0 +1,131 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    bounded_queue.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace tmns::fcs::notify {
+
+/**
+ * Fixed-capacity lock-free queue for many producers and one consumer.
+ *
+ * Each cell carries a sequence number that tells producers and the consumer
+ * whose turn it is, so a push or pop is one compare-exchange on the shared
+ * index plus a release store on the cell.  Pushing to a full queue fails
+ * instead of blocking.
+ */
+template <typename T>
+class Bounded_Queue
+{
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param capacity Minimum number of elements.  Rounded up to a power of two.
+         */
+        explicit Bounded_Queue( size_t capacity )
+            : m_mask( std::bit_ceil( capacity < 2 ? size_t{ 2 } : capacity ) - 1 ),
+              m_cells( std::make_unique<Cell[]>( m_mask + 1 ) )
+        {
+            for( size_t i = 0; i <= m_mask; ++i ) {
+                m_cells[i].sequence.store( i, std::memory_order_relaxed );
+            }
+        }
+
+        /**
+         * Add an element.  Safe to call from any thread.
+         *
+         * @return False if the queue is full; the value is left untouched
+         */
+        bool try_push( T& value )
+        {
+            auto position = m_tail.load( std::memory_order_relaxed );
+            for( ;; ) {
+                auto& cell = m_cells[position & m_mask];
+                const auto sequence = cell.sequence.load( std::memory_order_acquire );
+                const auto diff     = static_cast<std::ptrdiff_t>( sequence ) - static_cast<std::ptrdiff_t>( position );
+                if( diff == 0 ) {
+                    if( m_tail.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) ) {
+                        cell.value = std::move( value );
+                        cell.sequence.store( position + 1, std::memory_order_release );
+                        return true;
+                    }
+                }
+                else if( diff < 0 ) {
+                    return false;
+                }
+                else {
+                    position = m_tail.load( std::memory_order_relaxed );
+                }
+            }
+        }
+
+        /**
+         * Remove the oldest element.  Only one thread may pop.
+         *
+         * @return False if the queue is empty
+         */
+        bool try_pop( T& value )
+        {
+            const auto position = m_head.load( std::memory_order_relaxed );
+            auto& cell = m_cells[position & m_mask];
+            if( cell.sequence.load( std::memory_order_acquire ) != position + 1 ) {
+                return false;
+            }
+            value = std::move( cell.value );
+            cell.value = T();
+            cell.sequence.store( position + m_mask + 1, std::memory_order_release );
+            m_head.store( position + 1, std::memory_order_relaxed );
+            return true;
+        }
+
+        /**
+         * Get the approximate number of queued elements
+         */
+        size_t size() const
+        {
+            const auto head = m_head.load( std::memory_order_relaxed );
+            const auto tail = m_tail.load( std::memory_order_relaxed );
+            return tail > head ? tail - head : 0;
+        }
+
+        size_t capacity() const { return m_mask + 1; }
+
+    private:
+
+        struct alignas( 64 ) Cell
+        {
+            std::atomic<size_t> sequence{ 0 };
+            T                   value{};
+        };
+
+        size_t m_mask;
+
+        std::unique_ptr<Cell[]> m_cells;
+
+        /// Producers and the consumer touch separate cache lines
+        alignas( 64 ) std::atomic<size_t> m_tail{ 0 };
+
+        alignas( 64 ) std::atomic<size_t> m_head{ 0 };
+
+}; // End of Bounded_Queue class
+
+} // End of tmns::fcs::notify namespace
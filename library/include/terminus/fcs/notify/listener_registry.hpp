@@ -0,0 +1,178 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    listener_registry.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/result.hpp>
+
+// Project Libraries
+#include <terminus/fcs/prop/key_pool.hpp>
+#include <terminus/fcs/prop/property.hpp>
+
+namespace tmns::fcs::notify {
+
+/**
+ * Callback for a changed property.  The property is nullptr if it was removed,
+ * and is only valid during the call.
+ */
+using Change_Callback = std::function<void( std::string_view path, const prop::Property* property )>;
+
+/// Identifier returned when a listener is added
+using Listener_Id = uint64_t;
+
+/**
+ * Change listeners indexed by path pattern.
+ *
+ * A pattern is one of:
+ *  - an exact path, `app.server.port`, matching only that path
+ *  - a prefix, `app.server.*`, matching every path below `app.server`
+ *  - `**`, matching every path
+ *
+ * Listeners live in a trie keyed by path components, mirroring the property
+ * tree.  Finding the listeners for a change walks one branch of the trie, so it
+ * costs O(path depth) plus the number of matches, however many listeners exist.
+ *
+ * A change to an object, or a removal, also changes everything below it.  Its
+ * dispatch walks the trie below the path as well, so that cost grows with the
+ * listeners below the path, not with the size of the subtree.
+ *
+ * All methods are thread-safe.  Callbacks run outside the registry lock and may
+ * add or remove listeners.
+ */
+class Listener_Registry
+{
+    public:
+
+        /**
+         * Add a listener
+         *
+         * @return INVALID_INPUT if the pattern is empty or uses a wildcard other than a trailing `*` or a lone `**`
+         */
+        Result<Listener_Id> add( std::string_view pattern, Change_Callback callback );
+
+        /**
+         * Remove a listener
+         *
+         * @return False if the id is unknown
+         */
+        bool remove( Listener_Id id );
+
+        /**
+         * Invoke every listener matching a changed path.
+         *
+         * If the property is an object, or nullptr for a removal, listeners below
+         * the path are invoked too.  Exact listeners receive their own path, and
+         * prefix listeners receive the path of their prefix.  Each receives the
+         * property at that path in the new subtree, or nullptr if it is gone.
+         *
+         * @return Number of listeners invoked
+         */
+        size_t dispatch( std::string_view path, const prop::Property* property ) const;
+
+        /**
+         * Get the listeners matching a path, in registration order per pattern
+         */
+        std::vector<std::shared_ptr<const Change_Callback>> match( std::string_view path ) const;
+
+        /**
+         * Get the number of listeners.  Lock-free.
+         */
+        size_t size() const { return m_size.load( std::memory_order_acquire ); }
+
+        bool empty() const { return size() == 0; }
+
+    private:
+
+        struct Entry
+        {
+            Listener_Id                            id;
+            std::shared_ptr<const Change_Callback> callback;
+        };
+
+        struct Node
+        {
+            std::unordered_map<prop::Key_Atom, std::unique_ptr<Node>> children;
+
+            /// Listeners on exactly this path
+            std::vector<Entry> exact;
+
+            /// Listeners on every path below this one
+            std::vector<Entry> below;
+
+            bool empty() const { return children.empty() && exact.empty() && below.empty(); }
+        };
+
+        /// Listener to invoke for a path below a changed object
+        struct Delivery
+        {
+            std::string                            path;
+            const prop::Property*                  property;
+            std::shared_ptr<const Change_Callback> callback;
+        };
+
+        /// Where a listener is stored, for removal
+        struct Location
+        {
+            std::vector<prop::Key_Atom> atoms;
+            bool                        below{ false };
+        };
+
+        /**
+         * Find the node for a path, or nullptr if no listener is on or below it.  Requires the mutex.
+         */
+        const Node* find_node( std::string_view path ) const;
+
+        /**
+         * Collect the listeners on and below a node for a changed subtree.  Requires the mutex.
+         *
+         * @param path     Path of the node
+         * @param property Property at the path in the new subtree, or nullptr
+         * @param own      Whether the node's own exact listeners are collected
+         */
+        static void collect_below( const Node&            node,
+                                   std::string&           path,
+                                   const prop::Property*  property,
+                                   bool                   own,
+                                   std::vector<Delivery>& deliveries );
+
+        /**
+         * Remove empty nodes along a branch
+         */
+        static void prune( Node& node, const prop::Key_Atom* atoms, size_t count );
+
+        Node m_root;
+
+        std::unordered_map<Listener_Id, Location> m_locations;
+
+        Listener_Id m_next_id{ 1 };
+
+        std::atomic<size_t> m_size{ 0 };
+
+        mutable std::mutex m_mutex;
+
+}; // End of Listener_Registry class
+
+} // End of tmns::fcs::notify namespace
@@ -0,0 +1,72 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    path_handle.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/fcs/prop/key_pool.hpp>
+#include <terminus/fcs/prop/property.hpp>
+
+namespace tmns::fcs {
+
+namespace prop { class Object_Property; }
+
+/**
+ * Pre-compiled property path.
+ *
+ * Created by `Datastore::compile_path()`.  The path is interned once, and the
+ * resolved property is cached until the tree's structure generation changes.
+ * Handles are cheap to copy but are not thread-safe; keep one per thread.
+ */
+class Path_Handle
+{
+    public:
+
+        /**
+         * Default constructor.  Creates an empty handle which resolves to the root.
+         */
+        Path_Handle() = default;
+
+        /**
+         * Get the original dotted path
+         */
+        const std::string& get_path() const { return m_path; }
+
+        /**
+         * Get the interned path components
+         */
+        const std::vector<prop::Key_Atom>& get_segments() const { return m_segments; }
+
+    private:
+
+        friend class Datastore;
+
+        std::string m_path;
+
+        std::vector<prop::Key_Atom> m_segments;
+
+        /// Resolution cache, validated against the root and its structure generation
+        mutable const prop::Object_Property* m_cached_root{ nullptr };
+        mutable uint64_t m_cached_generation{ 0 };
+        mutable std::shared_ptr<prop::Property> m_cached_property;
+
+}; // End of Path_Handle class
+
+} // End of tmns::fcs namespace
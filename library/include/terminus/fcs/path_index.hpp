@@ -0,0 +1,95 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    path_index.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Project Libraries
+#include <terminus/fcs/prop/property.hpp>
+
+namespace tmns::fcs {
+
+/**
+ * Open-addressing hash index from a full dotted path to its property.
+ *
+ * Uses linear probing over a compact array of hashes, so a lookup touches one
+ * cache line in the common case and only compares keys on a hash match.
+ * Deletion uses backward shifting, so there are no tombstones.
+ */
+class Path_Index
+{
+    public:
+
+        /**
+         * Find the property for a path.  Returns nullptr if the path is not indexed.
+         */
+        const std::shared_ptr<prop::Property>* find( std::string_view path ) const;
+
+        /**
+         * Insert or replace the property for a path
+         */
+        void insert( std::string_view path, std::shared_ptr<prop::Property> property );
+
+        /**
+         * Remove a path from the index
+         *
+         * @return True if the path was indexed
+         */
+        bool erase( std::string_view path );
+
+        /**
+         * Remove every entry
+         */
+        void clear();
+
+        /**
+         * Get the number of indexed paths
+         */
+        size_t size() const { return m_size; }
+
+    private:
+
+        struct Entry
+        {
+            std::string                     path;
+            std::shared_ptr<prop::Property> property;
+        };
+
+        /**
+         * Hash a path.  Zero is reserved to mark empty slots.
+         */
+        static uint64_t hash_path( std::string_view path );
+
+        /**
+         * Resize the table to the given power-of-two capacity
+         */
+        void rehash( size_t capacity );
+
+        /// Slot hashes, zero when the slot is empty
+        std::vector<uint64_t> m_hashes;
+
+        /// Slot contents, parallel to m_hashes
+        std::vector<Entry> m_entries;
+
+        size_t m_size{ 0 };
+
+}; // End of Path_Index class
+
+} // End of tmns::fcs namespace
@@ -36,10 +36,21 @@ class Array_Property : public Property
 {
     public:
 
-        Array_Property() = default;
+        Array_Property();
 
         explicit Array_Property(const std::string& key);
 
+        /**
+         * Copy constructor.  Items are shared with the original.
+         */
+        Array_Property( const Array_Property& other );
+
+        /**
+         * Copy this array, sharing its items
+         */
+        std::shared_ptr<Property> clone_node( const std::shared_ptr<Property_Arena>& arena,
+                                              uint64_t                               edit ) const override;
+
         Result<void> set_value(const std::any& value) override;
 
         Result<std::any> get_value() const override;
@@ -51,6 +62,11 @@ class Array_Property : public Property
 
         Result<std::shared_ptr<Property>> get_item(size_t index) const;
 
+        /**
+         * Borrow an item without bounds checking or copying the pointer
+         */
+        const std::shared_ptr<Property>& item_at( size_t index ) const { return m_items[index]; }
+
         Result<void> remove_item(size_t index);
 
         size_t size() const { return m_items.size(); }
@@ -59,9 +75,29 @@ class Array_Property : public Property
 
         std::string get_type_string() const override { return "array"; }
 
+        Subtree_Stats get_subtree_stats() const override { return m_stats; }
+
+        size_t approximate_bytes() const override;
+
+    protected:
+
+        Subtree_Stats* container_stats() override { return &m_stats; }
+
+        size_t compute_height() const override;
+
+        uint64_t child_hash_term( const Property& child, uint64_t child_hash ) const override;
+
     private:
 
+        /**
+         * Recompute the content hash from every item, after items moved
+         */
+        uint64_t compute_hash() const;
+
         std::vector<std::shared_ptr<Property>> m_items;
+
+        /// Aggregates over this subtree
+        Subtree_Stats m_stats{ Subtree_Stats::single( schema::Property_Value_Type::ARRAY, sizeof( Array_Property ) ) };
 };
 
 } // namespace tmns::fcs::prop
\ No newline at end of file
@@ -0,0 +1,116 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    content_hash.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Project Libraries
+#include <terminus/fcs/schema/property_value_type.hpp>
+
+namespace tmns::fcs::prop {
+
+/**
+ * Content hashes of property trees.
+ *
+ * Hashes depend only on keys, types and values, never on addresses or key
+ * atoms, so equal trees hash equally in every process.  A container's hash is
+ * its type's seed plus one term per child.  Addition commutes, so replacing a
+ * child updates the sum in O(1) and a change reaches the root in O(depth).
+ */
+namespace content_hash {
+
+/**
+ * Finalize a 64-bit value.  The splitmix64 finalizer.
+ */
+constexpr uint64_t mix( uint64_t value )
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+/**
+ * Hash a byte string.  64-bit FNV-1a, stable across processes and platforms.
+ */
+constexpr uint64_t bytes( std::string_view data )
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for( char c : data ) {
+        hash ^= static_cast<unsigned char>( c );
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/**
+ * Get the seed for a property type
+ */
+constexpr uint64_t seed( schema::Property_Value_Type type )
+{
+    return mix( 0x9e3779b97f4a7c15ULL * ( static_cast<uint64_t>( type ) + 1 ) );
+}
+
+/**
+ * Hash a leaf value of a given type
+ */
+template <typename T>
+uint64_t leaf( schema::Property_Value_Type type, const T& value )
+{
+    uint64_t hash;
+    if constexpr( std::is_same_v<T, std::string> ) {
+        hash = bytes( value );
+    }
+    else if constexpr( std::is_same_v<T, std::filesystem::path> ) {
+        hash = bytes( value.generic_string() );
+    }
+    else if constexpr( std::is_same_v<T, float> ) {
+        hash = std::bit_cast<uint32_t>( value );
+    }
+    else if constexpr( std::is_same_v<T, double> ) {
+        hash = std::bit_cast<uint64_t>( value );
+    }
+    else {
+        hash = static_cast<uint64_t>( value );
+    }
+    return mix( seed( type ) ^ mix( hash ) );
+}
+
+/**
+ * Get the term an object adds to its hash for a child
+ */
+inline uint64_t object_term( std::string_view key, uint64_t child_hash )
+{
+    return mix( bytes( key ) ^ mix( child_hash + 0x632be59bd9b4e019ULL ) );
+}
+
+/**
+ * Get the term an array adds to its hash for the item at an index
+ */
+inline uint64_t array_term( size_t index, uint64_t item_hash )
+{
+    return mix( mix( index + 0x8cb92ba72f3d8dd7ULL ) ^ item_hash );
+}
+
+} // End of content_hash namespace
+} // End of tmns::fcs::prop namespace
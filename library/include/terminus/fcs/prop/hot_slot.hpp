@@ -0,0 +1,123 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    hot_slot.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace tmns::fcs::prop {
+
+/**
+ * Check if a value type can be stored in a Hot_Slot
+ */
+template <typename T>
+inline constexpr bool is_hot_value_v = std::is_same_v<T, int64_t> ||
+                                       std::is_same_v<T, float>   ||
+                                       std::is_same_v<T, double>  ||
+                                       std::is_same_v<T, bool>;
+
+/**
+ * Atomic copy of a frequently read scalar, on its own cache line.
+ *
+ * The slot mirrors a property of a Datastore.  The datastore stores into it
+ * after each write to the property is published, so readers always see a
+ * committed value.  Every store that changes the value bumps a change counter.
+ */
+template <typename T>
+class alignas( 64 ) Hot_Slot
+{
+        static_assert( is_hot_value_v<T>, "Hot_Slot requires an integer, float, double or boolean value" );
+
+    public:
+
+        using value_type = T;
+
+        /**
+         * Constructor
+         *
+         * @param value Initial value
+         */
+        explicit Hot_Slot( T value ) : m_value( value ) {}
+
+        T load() const { return m_value.load( std::memory_order_acquire ); }
+
+        /**
+         * Publish a new value.  Storing the current value again is not counted as a change.
+         */
+        void store( T value )
+        {
+            if( m_value.exchange( value, std::memory_order_acq_rel ) != value ) {
+                m_changes.fetch_add( 1, std::memory_order_release );
+            }
+        }
+
+        /**
+         * Get the number of times the value changed.  Watchers compare it to detect changes.
+         */
+        uint64_t changes() const { return m_changes.load( std::memory_order_acquire ); }
+
+        Hot_Slot( const Hot_Slot& ) = delete;
+        Hot_Slot& operator=( const Hot_Slot& ) = delete;
+
+    private:
+
+        std::atomic<T> m_value;
+
+        std::atomic<uint64_t> m_changes{ 0 };
+
+}; // End of Hot_Slot class
+
+/**
+ * Stable read handle to a hot property.
+ *
+ * Loads are single atomic operations with no tree walk or lock.  Write the
+ * property through its Datastore, which validates, versions and publishes the
+ * value, notifies listeners, and then updates every handle.  An empty handle
+ * loads a default-constructed value.
+ */
+template <typename T>
+class Hot_Handle
+{
+    public:
+
+        /**
+         * Default constructor.  Creates an empty handle.
+         */
+        Hot_Handle() = default;
+
+        explicit Hot_Handle( std::shared_ptr<const Hot_Slot<T>> slot ) : m_slot( std::move( slot ) ) {}
+
+        /**
+         * Check if the handle refers to a slot
+         */
+        explicit operator bool() const { return m_slot != nullptr; }
+
+        T load() const { return m_slot ? m_slot->load() : T{}; }
+
+        /**
+         * Get the number of times the value changed since the handle was first taken
+         */
+        uint64_t changes() const { return m_slot ? m_slot->changes() : 0; }
+
+    private:
+
+        std::shared_ptr<const Hot_Slot<T>> m_slot;
+
+}; // End of Hot_Handle class
+
+} // namespace tmns::fcs::prop
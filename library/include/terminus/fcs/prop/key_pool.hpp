@@ -0,0 +1,146 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    key_pool.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/result.hpp>
+
+namespace tmns::fcs::prop {
+
+/// Interned property key
+using Key_Atom = uint32_t;
+
+/// Atom that no key has.  Stands in for a key the full pool could not intern, which no property can have either.
+constexpr Key_Atom NO_KEY_ATOM = UINT32_MAX;
+
+/**
+ * Interned key table shared by every property tree in the process.
+ *
+ * Each distinct key is stored once and identified by a 32-bit atom, so
+ * properties and their parents hold atoms instead of strings, and key
+ * comparisons are integer compares.  A single process-wide pool keeps atoms
+ * comparable across Datastores, which lets subtrees be shared and compared
+ * between them.
+ *
+ * Interning a key that is already present, `find()`, `str()`, `size()` and
+ * `bytes()` are lock-free, so readers can translate keys while another thread
+ * interns.  Only adding a new key takes the lock.  Keys are never freed: atoms
+ * are held by trees in every Datastore and must keep their meaning, so the
+ * pool grows with the number of distinct keys, not with the number of writes.
+ */
+class Key_Pool
+{
+    public:
+
+        /**
+         * Get the process-wide pool
+         */
+        static Key_Pool& instance();
+
+        /**
+         * Get the atom for a key, adding it to the pool if needed.  Lock-free if the key is present.
+         *
+         * @return OUT_OF_BOUNDS if the key is new and the pool is full
+         */
+        Result<Key_Atom> intern( std::string_view key );
+
+        /**
+         * Get the atom for a key without adding it.  Lock-free.
+         */
+        std::optional<Key_Atom> find( std::string_view key ) const;
+
+        /**
+         * Get the text of an atom.  The reference is valid for the life of the process.
+         */
+        const std::string& str( Key_Atom atom ) const
+        {
+            return entry( atom ).text;
+        }
+
+        /**
+         * Get the number of interned keys
+         */
+        size_t size() const { return m_size.load( std::memory_order_acquire ); }
+
+        /**
+         * Get the approximate number of bytes used by the pool
+         */
+        size_t bytes() const;
+
+        Key_Pool( const Key_Pool& ) = delete;
+        Key_Pool& operator=( const Key_Pool& ) = delete;
+
+    private:
+
+        struct Entry
+        {
+            std::string text;
+            uint64_t    hash{ 0 };
+        };
+
+        /// Open-addressing table of atom + 1, zero when empty
+        struct Table
+        {
+            size_t                                   mask{ 0 };
+            std::unique_ptr<std::atomic<uint32_t>[]> slots;
+        };
+
+        static constexpr size_t CHUNK_BITS = 10;
+        static constexpr size_t CHUNK_SIZE = size_t{ 1 } << CHUNK_BITS;
+        static constexpr size_t MAX_CHUNKS = size_t{ 1 } << 14;
+
+        Key_Pool();
+
+        const Entry& entry( Key_Atom atom ) const
+        {
+            return m_chunks[atom >> CHUNK_BITS].load( std::memory_order_acquire )[atom & ( CHUNK_SIZE - 1 )];
+        }
+
+        static uint64_t hash_key( std::string_view key );
+
+        /**
+         * Allocate a table and place every existing atom in it
+         */
+        std::unique_ptr<Table> build_table( size_t capacity ) const;
+
+        /// Entries in fixed-size chunks so references never move
+        std::array<std::atomic<Entry*>, MAX_CHUNKS> m_chunks{};
+
+        std::atomic<Table*> m_table{ nullptr };
+
+        /// Every table ever published.  Retired tables stay alive for concurrent readers.
+        std::vector<std::unique_ptr<Table>> m_tables;
+
+        std::atomic<size_t> m_size{ 0 };
+
+        /// Bytes of key text, entry chunks and tables, kept for bytes()
+        std::atomic<size_t> m_bytes{ 0 };
+
+        mutable std::mutex m_mutex;
+
+}; // End of Key_Pool class
+
+} // End of tmns::fcs::prop namespace
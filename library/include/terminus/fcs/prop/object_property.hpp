@@ -16,17 +16,29 @@
 
 // C++ Standard Libraries
 #include <any>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
 
 // Terminus Libraries
 #include <terminus/error.hpp>
 
 // Project Libraries
+#include <terminus/fcs/prop/key_pool.hpp>
+#include <terminus/fcs/prop/path_segments.hpp>
 #include <terminus/fcs/prop/property.hpp>
 
 namespace tmns::fcs::prop {
 
 /**
  * Property that represents a nested object (tree node)
+ *
+ * Children are kept in a flat map sorted by interned key atom: atoms and
+ * children live in two parallel arrays.  A string lookup translates the key to
+ * its atom once, then small objects are searched by a linear scan over the
+ * atoms, which fit in one cache line, and larger objects by a binary search.
+ * Iteration follows atom order, which is stable but not alphabetical.
  */
 class Object_Property : public Property,
                         public std::enable_shared_from_this<Object_Property>
@@ -36,13 +48,24 @@ class Object_Property : public Property,
         /**
          * Default constructor
          */
-        Object_Property() = default;
+        Object_Property();
 
         /**
          * Constructor with key
          */
         explicit Object_Property( const std::string& key );
 
+        /**
+         * Copy constructor.  Children are shared with the original.
+         */
+        Object_Property( const Object_Property& other );
+
+        /**
+         * Copy this object, sharing its children
+         */
+        std::shared_ptr<Property> clone_node( const std::shared_ptr<Property_Arena>& arena,
+                                              uint64_t                               edit ) const override;
+
         /**
          * Set the value of the property
          */
@@ -66,25 +89,50 @@ class Object_Property : public Property,
         /**
          * Get a property from the object
          */
-        Result<std::shared_ptr<Property>> get_property( const std::string& key ) const;
+        Result<std::shared_ptr<Property>> get_property( std::string_view key ) const;
 
         /**
          * Remove a property from the object
          */
-        Result<void> remove_property( const std::string& key );
+        Result<void> remove_property( std::string_view key );
+
+        /**
+         * Resolve a dotted path to a property.  Does not allocate on success.
+         */
+        Result<std::shared_ptr<Property>> resolve_path( std::string_view path ) const;
+
+        /**
+         * Resolve a dotted path without allocating or touching reference counts.
+         *
+         * @return Pointer to the stored child, or nullptr if a component is missing,
+         *         is not an object, or the path is empty
+         */
+        const std::shared_ptr<Property>* find_path( std::string_view path ) const;
+
+        /**
+         * Resolve a pre-interned path to a property
+         */
+        Result<std::shared_ptr<Property>> resolve_path( const std::vector<Key_Atom>& path_atoms ) const;
 
         /**
-         * Resolve a path to a property
+         * Get a direct child that the writer holding `edit` may modify in place.
+         *
+         * A child owned by another edit is first replaced by a copy, so trees that
+         * share it are unaffected.  This object must itself be owned by the edit.
+         *
+         * @return Pointer to the stored child, or nullptr if it is missing
          */
-        Result<std::shared_ptr<Property>> resolve_path( const std::string& path ) const;
+        const std::shared_ptr<Property>* writable_child( std::string_view                       key,
+                                                         const std::shared_ptr<Property_Arena>& arena,
+                                                         uint64_t                               edit );
 
         /**
          * Set a value at a path
          */
-        Result<void> set_path_value(const std::string& path, const std::any& value);
+        Result<void> set_path_value( std::string_view path, const std::any& value );
 
         /**
-         * Get the child keys
+         * Get an alphabetically sorted copy of the child keys
          */
         std::vector<std::string> get_child_keys() const;
 
@@ -93,6 +141,40 @@ class Object_Property : public Property,
          */
         bool has_children() const { return !m_children.empty(); }
 
+        /**
+         * Get the number of direct children
+         */
+        size_t child_count() const { return m_children.size(); }
+
+        /**
+         * Get the key of the child at a position.  Children are ordered by atom.
+         */
+        const std::string& child_key( size_t index ) const { return Key_Pool::instance().str( m_child_atoms[index] ); }
+
+        /**
+         * Get the key atom of the child at a position
+         */
+        Key_Atom child_atom( size_t index ) const { return m_child_atoms[index]; }
+
+        /**
+         * Get the child at a position.  Children are ordered by atom.
+         */
+        const std::shared_ptr<Property>& child_at( size_t index ) const { return m_children[index]; }
+
+        /**
+         * Visit every child in atom order without copying keys.
+         *
+         * @param func Callable taking (const std::string& key, const std::shared_ptr<Property>& child)
+         */
+        template <typename Func>
+        void for_each_child( Func&& func ) const
+        {
+            const auto& pool = Key_Pool::instance();
+            for( size_t i = 0; i < m_children.size(); ++i ) {
+                func( pool.str( m_child_atoms[i] ), m_children[i] );
+            }
+        }
+
         /**
          * Get the type of the property
          */
@@ -106,10 +188,55 @@ class Object_Property : public Property,
          */
         std::string get_type_string() const override;
 
+        /**
+         * Get the statistics of this object's subtree.  O(1).
+         */
+        Subtree_Stats get_subtree_stats() const override { return m_stats; }
+
+        /**
+         * Get the approximate memory held by this object and its child list
+         */
+        size_t approximate_bytes() const override;
+
+    protected:
+
+        Subtree_Stats* container_stats() override { return &m_stats; }
+
+        size_t compute_height() const override;
+
+        uint64_t child_hash_term( const Property& child, uint64_t child_hash ) const override;
+
     private:
-        std::unordered_map<std::string, std::shared_ptr<Property>> m_children;
 
-        std::vector<std::string> split_path(const std::string& path) const;
+        /**
+         * Find a direct child without allocating.  Returns nullptr if missing.
+         */
+        const std::shared_ptr<Property>* find_child( std::string_view key ) const;
+
+        /**
+         * Find a direct child by key atom.  Returns nullptr if missing.
+         */
+        const std::shared_ptr<Property>* find_child( Key_Atom atom ) const;
+
+        /**
+         * Walk a sequence of path components starting at this object
+         */
+        template <typename Segment_Range>
+        Result<std::shared_ptr<Property>> resolve_segments( const Segment_Range& segments ) const;
+
+        /**
+         * Find the position of a child, or the insertion point if it is missing
+         */
+        size_t lower_bound( Key_Atom atom ) const;
+
+        /// Sorted child key atoms
+        std::vector<Key_Atom> m_child_atoms;
+
+        /// Children, in the same order as m_child_atoms
+        std::vector<std::shared_ptr<Property>> m_children;
+
+        /// Aggregates over this subtree
+        Subtree_Stats m_stats{ Subtree_Stats::single( schema::Property_Value_Type::OBJECT, sizeof( Object_Property ) ) };
 };
 
 } // namespace tmns::fcs::prop
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    path_segments.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace tmns::fcs::prop {
+
+/**
+ * Non-allocating view over the components of a dotted path.
+ *
+ * Empty components are skipped, so "a..b" and ".a.b." both yield "a" and "b".
+ */
+class Path_Segments
+{
+    public:
+
+        /**
+         * Forward iterator yielding each component as a string_view into the path
+         */
+        class Iterator
+        {
+            public:
+
+                using iterator_category = std::forward_iterator_tag;
+                using value_type        = std::string_view;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = const std::string_view*;
+                using reference         = const std::string_view&;
+
+                Iterator() = default;
+
+                Iterator( std::string_view path, size_t pos )
+                    : m_path( path ), m_pos( pos )
+                {
+                    advance();
+                }
+
+                reference operator*() const { return m_segment; }
+
+                pointer operator->() const { return &m_segment; }
+
+                Iterator& operator++()
+                {
+                    m_pos += m_segment.size();
+                    advance();
+                    return *this;
+                }
+
+                Iterator operator++(int)
+                {
+                    Iterator temp = *this;
+                    ++( *this );
+                    return temp;
+                }
+
+                bool operator==( const Iterator& other ) const { return m_pos == other.m_pos; }
+
+            private:
+
+                /**
+                 * Skip separators and capture the next component
+                 */
+                void advance()
+                {
+                    while( m_pos < m_path.size() && m_path[m_pos] == '.' ) {
+                        ++m_pos;
+                    }
+                    if( m_pos >= m_path.size() ) {
+                        m_pos     = std::string_view::npos;
+                        m_segment = {};
+                        return;
+                    }
+                    auto end  = m_path.find( '.', m_pos );
+                    m_segment = m_path.substr( m_pos, end == std::string_view::npos ? end : end - m_pos );
+                }
+
+                std::string_view m_path;
+                size_t           m_pos{ std::string_view::npos };
+                std::string_view m_segment;
+        };
+
+        /**
+         * Constructor
+         */
+        explicit Path_Segments( std::string_view path ) : m_path( path ) {}
+
+        Iterator begin() const { return Iterator( m_path, 0 ); }
+
+        Iterator end() const { return Iterator(); }
+
+        /**
+         * Check if the path has no components
+         */
+        bool empty() const { return begin() == end(); }
+
+    private:
+
+        std::string_view m_path;
+
+}; // End of Path_Segments class
+
+} // End of tmns::fcs::prop namespace
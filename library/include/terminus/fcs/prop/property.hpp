@@ -16,6 +16,7 @@
 
 // C++ Standard Libraries
 #include <any>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -24,8 +25,13 @@
 
 // Terminus Libraries
 #include <terminus/error.hpp>
+#include <terminus/fcs/prop/content_hash.hpp>
+#include <terminus/fcs/prop/key_pool.hpp>
+#include <terminus/fcs/prop/property_arena.hpp>
+#include <terminus/fcs/prop/subtree_stats.hpp>
 #include <terminus/fcs/schema/property_value_type.hpp>
 #include <terminus/fcs/schema/schema.hpp>
+#include <terminus/fcs/value.hpp>
 
 namespace tmns::fcs::prop {
 
@@ -38,6 +44,10 @@ class Property {
 
         Property() = default;
 
+        /**
+         * Constructor.  If the key pool is full and the key is new, the property
+         * starts with the empty key; Datastore::insert_property() reports the error.
+         */
         explicit Property(const std::string& key);
 
         virtual ~Property() = default;
@@ -47,9 +57,27 @@ class Property {
         virtual Result<std::any> get_value() const = 0;
         virtual Result<void> validate() const = 0;
 
+        /**
+         * Set a scalar value.  Fails with TYPE_MISMATCH if the alternative does not
+         * match the property type, and NOT_SUPPORTED on containers.
+         */
+        virtual Result<void> set_scalar_value( const Value& value );
+
+        /**
+         * Get a scalar value.  Does not throw; fails with NOT_SUPPORTED on containers.
+         */
+        virtual Result<Value> get_scalar_value() const;
+
         // Key operations
-        const std::string& get_key() const { return m_key; }
-        void set_key(const std::string& key) { m_key = key; }
+        const std::string& get_key() const { return Key_Pool::instance().str(m_key); }
+        Key_Atom get_key_atom() const { return m_key; }
+
+        /**
+         * Set the key
+         *
+         * @return OUT_OF_BOUNDS if the key is new and the key pool is full
+         */
+        Result<void> set_key( std::string_view key );
 
         // Schema operations
         void set_schema(std::optional<schema::Schema> schema) { m_schema = std::move(schema); }
@@ -59,9 +87,156 @@ class Property {
         virtual schema::Property_Value_Type get_type() const = 0;
         virtual std::string get_type_string() const = 0;
 
+        /**
+         * Get the structure generation of this property's subtree.
+         *
+         * Stamps are unique across all properties and change whenever a descendant
+         * is added or removed, so a cached lookup can be validated by comparing the
+         * root's stamp.
+         */
+        uint64_t get_structure_generation() const { return m_structure_generation; }
+
+        /**
+         * Get the version of this property's value.
+         *
+         * Versions are drawn from the same global counter as structure stamps, so
+         * they only grow and a replacement property never repeats an old version.
+         * Setting the value, or adding or removing a child of a container, moves
+         * it forward.  Copies made for copy-on-write keep the original's version.
+         */
+        uint64_t get_version() const { return m_version; }
+
+        /**
+         * Get the content hash of this property's value, or of its whole subtree for
+         * containers.  O(1); containers keep it current as their children change.
+         *
+         * Equal values and subtrees hash equally in every process, so comparing
+         * root hashes tells whether two trees differ.  The property's own key and
+         * schema are not included; a container includes its children's keys.
+         */
+        uint64_t get_content_hash() const { return m_hash; }
+
+        /**
+         * Get the statistics of this property's subtree.  O(1).
+         */
+        virtual Subtree_Stats get_subtree_stats() const;
+
+        /**
+         * Get the approximate memory held by this property alone, including any
+         * heap storage of its value or child list but not its children
+         */
+        virtual size_t approximate_bytes() const { return sizeof( Property ); }
+
+        /**
+         * Copy this node for copy-on-write.
+         *
+         * Children are shared with the original, not copied.  The copy has no
+         * parent and may be modified in place by the writer holding `edit`.
+         */
+        virtual std::shared_ptr<Property> clone_node( const std::shared_ptr<Property_Arena>& arena,
+                                                      uint64_t                               edit ) const = 0;
+
+        /**
+         * Get the edit token of the writer allowed to modify this node in place.
+         * Zero for nodes that were never cloned.
+         */
+        uint64_t get_edit() const { return m_edit; }
+
     protected:
 
-        std::string m_key;
+        /**
+         * Copy the key and schema.  The copy starts detached, with a fresh stamp.
+         */
+        Property( const Property& other );
+
+        Property& operator=( const Property& ) = delete;
+
+        /**
+         * Get the aggregate storage of a container.  Leaves return nullptr.
+         */
+        virtual Subtree_Stats* container_stats() { return nullptr; }
+
+        /**
+         * Recompute a container's height from its children
+         */
+        virtual size_t compute_height() const { return 0; }
+
+        /**
+         * Add a newly attached child's subtree to this container and its ancestors
+         */
+        void stats_added( const Subtree_Stats& child_stats );
+
+        /**
+         * Remove a detached child's subtree from this container and its ancestors
+         */
+        void stats_removed( const Subtree_Stats& child_stats );
+
+        /**
+         * Apply a change in this property's own size to every enclosing aggregate
+         */
+        void adjust_bytes( std::ptrdiff_t delta );
+
+        /**
+         * Restamp this property and all of its ancestors after a structural change
+         */
+        void mark_structure_changed();
+
+        /**
+         * Get the term a container adds to its hash for a child with a given hash
+         */
+        virtual uint64_t child_hash_term( [[maybe_unused]] const Property& child,
+                                          [[maybe_unused]] uint64_t        child_hash ) const { return 0; }
+
+        /**
+         * Set this property's content hash and carry the change up through its ancestors
+         */
+        void update_hash( uint64_t hash );
+
+        /**
+         * Give this property a new version after its value changed
+         */
+        void mark_value_changed() { m_version = next_generation(); }
+
+        /**
+         * Record this property as the container holding the child, at a position
+         * that only arrays use
+         */
+        void attach_child( Property& child, size_t position = 0 );
+
+        /**
+         * Get the position the child was last attached at.  A hint only; nodes
+         * shared between containers may have been moved by another one.
+         */
+        static size_t attached_position( const Property& child ) { return child.m_position; }
+
+        /**
+         * Clear the child's container pointer if it still refers to this property
+         */
+        void detach_child( Property& child );
+
+        /**
+         * Get the next globally unique generation stamp
+         */
+        static uint64_t next_generation();
+
+        /// Non-owning pointer to the container holding this property
+        Property* m_parent{ nullptr };
+
+        /// Position within the container holding this property; see attached_position()
+        size_t m_position{ 0 };
+
+        uint64_t m_structure_generation{ next_generation() };
+
+        /// Value version; see get_version()
+        uint64_t m_version{ m_structure_generation };
+
+        /// Content hash; see get_content_hash().  Set by each subclass's constructors.
+        uint64_t m_hash{ 0 };
+
+        /// Edit token of the writer that owns this node; see clone_node()
+        uint64_t m_edit{ 0 };
+
+        Key_Atom m_key{ 0 };
         schema::Property_Value_Type m_type;
         std::optional<schema::Schema> m_schema;
 };
@@ -0,0 +1,164 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    property_arena.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace tmns::fcs::prop {
+
+/**
+ * Pooled memory resource that property nodes are allocated from.
+ *
+ * Nodes of the same size share pool chunks, so building a large tree makes a
+ * few large upstream requests instead of one malloc per node, and destroying
+ * the arena returns every chunk at once.  The arena is thread-safe, because
+ * nodes may be released on any thread.
+ */
+class Property_Arena : public std::pmr::memory_resource
+{
+    public:
+
+        /**
+         * Allocation statistics, for sizing the arena
+         */
+        struct Stats
+        {
+            /// Bytes currently handed out to nodes
+            size_t bytes_in_use{ 0 };
+
+            /// High-water mark of bytes_in_use
+            size_t peak_bytes_in_use{ 0 };
+
+            /// Number of live allocations
+            size_t live_allocations{ 0 };
+
+            /// Number of allocations made over the arena's lifetime
+            size_t total_allocations{ 0 };
+
+            /// Bytes currently reserved from the upstream resource
+            size_t upstream_bytes{ 0 };
+        };
+
+        /**
+         * Constructor
+         *
+         * @param upstream Resource the pool draws its chunks from
+         */
+        explicit Property_Arena( std::pmr::memory_resource* upstream = std::pmr::new_delete_resource() );
+
+        /**
+         * Get a snapshot of the allocation statistics
+         */
+        Stats stats() const;
+
+    private:
+
+        /**
+         * Pass-through resource that counts the bytes reserved by the pool
+         */
+        class Counting_Upstream : public std::pmr::memory_resource
+        {
+            public:
+
+                explicit Counting_Upstream( std::pmr::memory_resource* upstream ) : m_upstream( upstream ) {}
+
+                size_t bytes() const { return m_bytes.load( std::memory_order_relaxed ); }
+
+            private:
+
+                void* do_allocate( size_t bytes, size_t alignment ) override;
+                void do_deallocate( void* ptr, size_t bytes, size_t alignment ) override;
+                bool do_is_equal( const std::pmr::memory_resource& other ) const noexcept override;
+
+                std::pmr::memory_resource* m_upstream;
+                std::atomic<size_t>        m_bytes{ 0 };
+        };
+
+        void* do_allocate( size_t bytes, size_t alignment ) override;
+        void do_deallocate( void* ptr, size_t bytes, size_t alignment ) override;
+        bool do_is_equal( const std::pmr::memory_resource& other ) const noexcept override;
+
+        Counting_Upstream                    m_upstream;
+        std::pmr::synchronized_pool_resource m_pool;
+
+        std::atomic<size_t> m_bytes_in_use{ 0 };
+        std::atomic<size_t> m_peak_bytes_in_use{ 0 };
+        std::atomic<size_t> m_live_allocations{ 0 };
+        std::atomic<size_t> m_total_allocations{ 0 };
+
+}; // End of Property_Arena class
+
+/**
+ * Allocator that keeps its arena alive.
+ *
+ * Used with `std::allocate_shared`, so each node's control block holds a
+ * reference to the arena and nodes may safely outlive the Datastore that made them.
+ */
+template <typename T>
+class Arena_Allocator
+{
+    public:
+
+        using value_type = T;
+
+        explicit Arena_Allocator( std::shared_ptr<Property_Arena> arena ) noexcept
+            : m_arena( std::move( arena ) ) {}
+
+        template <typename U>
+        Arena_Allocator( const Arena_Allocator<U>& other ) noexcept
+            : m_arena( other.arena() ) {}
+
+        T* allocate( size_t count )
+        {
+            return static_cast<T*>( m_arena->allocate( count * sizeof( T ), alignof( T ) ) );
+        }
+
+        void deallocate( T* ptr, size_t count ) noexcept
+        {
+            m_arena->deallocate( ptr, count * sizeof( T ), alignof( T ) );
+        }
+
+        const std::shared_ptr<Property_Arena>& arena() const noexcept { return m_arena; }
+
+        template <typename U>
+        bool operator==( const Arena_Allocator<U>& other ) const noexcept
+        {
+            return m_arena == other.arena();
+        }
+
+    private:
+
+        std::shared_ptr<Property_Arena> m_arena;
+
+}; // End of Arena_Allocator class
+
+/**
+ * Create a node in an arena, or on the heap if no arena is given
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> make_node( const std::shared_ptr<Property_Arena>& arena, Args&&... args )
+{
+    if( !arena ) {
+        return std::make_shared<T>( std::forward<Args>( args )... );
+    }
+    return std::allocate_shared<T>( Arena_Allocator<T>( arena ), std::forward<Args>( args )... );
+}
+
+} // End of tmns::fcs::prop namespace
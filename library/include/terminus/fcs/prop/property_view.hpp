@@ -0,0 +1,120 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    property_view.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <string_view>
+
+// Project Libraries
+#include <terminus/fcs/prop/array_property.hpp>
+#include <terminus/fcs/prop/object_property.hpp>
+#include <terminus/fcs/prop/typed_property.hpp>
+#include <terminus/fcs/value.hpp>
+
+namespace tmns::fcs::prop {
+
+/**
+ * Borrowed, read-only handle to a property.
+ *
+ * A view is a plain pointer: copying it and walking through it never touch a
+ * reference count, so many threads can read the same tree without sharing a
+ * written cache line.  A view is valid while whatever owns the tree keeps it
+ * alive and unchanged, such as a held snapshot or a lock guard; it does not
+ * extend the property's lifetime.
+ */
+class Property_View
+{
+    public:
+
+        /**
+         * Default constructor.  Creates an empty view.
+         */
+        Property_View() = default;
+
+        /**
+         * Constructor
+         */
+        explicit Property_View( const Property* property ) : m_property( property ) {}
+
+        /**
+         * Check if the view refers to a property
+         */
+        explicit operator bool() const { return m_property != nullptr; }
+
+        const Property& operator*() const { return *m_property; }
+
+        const Property* operator->() const { return m_property; }
+
+        const Property* get() const { return m_property; }
+
+        /**
+         * Borrow the typed value.  Returns nullptr if the view is empty or holds another type.
+         */
+        template <typename T>
+        const T* as() const
+        {
+            return typed_value_ptr<T>( m_property );
+        }
+
+        /**
+         * Resolve a dotted path below an object.  Returns an empty view if not found.
+         */
+        Property_View find( std::string_view path ) const
+        {
+            if( m_property == nullptr || m_property->get_type() != schema::Property_Value_Type::OBJECT ) {
+                return Property_View();
+            }
+            auto found = static_cast<const Object_Property*>( m_property )->find_path( path );
+            return Property_View( found ? found->get() : nullptr );
+        }
+
+        /**
+         * Get an array item.  Returns an empty view if out of range or not an array.
+         */
+        Property_View item( size_t index ) const
+        {
+            if( m_property == nullptr || m_property->get_type() != schema::Property_Value_Type::ARRAY ) {
+                return Property_View();
+            }
+            const auto& array = static_cast<const Array_Property&>( *m_property );
+            return Property_View( index < array.size() ? array.item_at( index ).get() : nullptr );
+        }
+
+        /**
+         * Get the number of children or items.  Zero for scalars and empty views.
+         */
+        size_t size() const
+        {
+            if( m_property == nullptr ) {
+                return 0;
+            }
+            switch( m_property->get_type() ) {
+                case schema::Property_Value_Type::OBJECT:
+                    return static_cast<const Object_Property*>( m_property )->child_count();
+                case schema::Property_Value_Type::ARRAY:
+                    return static_cast<const Array_Property*>( m_property )->size();
+                default:
+                    return 0;
+            }
+        }
+
+    private:
+
+        const Property* m_property{ nullptr };
+
+}; // End of Property_View class
+
+} // End of tmns::fcs::prop namespace
@@ -0,0 +1,80 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    subtree_stats.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <cstddef>
+
+// Project Libraries
+#include <terminus/fcs/schema/property_value_type.hpp>
+
+namespace tmns::fcs::prop {
+
+/**
+ * Aggregate statistics for a property and everything below it.
+ *
+ * Containers keep these current as children are added, removed or resized,
+ * so reading them is O(1).
+ */
+struct Subtree_Stats
+{
+    /// Number of types in schema::Property_Value_Type
+    static constexpr size_t TYPE_COUNT = static_cast<size_t>( schema::Property_Value_Type::ARRAY ) + 1;
+
+    /// Properties in the subtree, including its root
+    size_t node_count{ 0 };
+
+    /// Properties in the subtree by type
+    std::array<size_t, TYPE_COUNT> type_counts{};
+
+    /// Longest path from the subtree root down to a leaf, in edges
+    size_t height{ 0 };
+
+    /// Approximate memory held by the subtree's nodes and values
+    size_t bytes{ 0 };
+
+    /**
+     * Get the statistics of a single property with no children
+     */
+    static Subtree_Stats single( schema::Property_Value_Type type, size_t bytes )
+    {
+        Subtree_Stats stats;
+        stats.node_count = 1;
+        stats.type_counts[static_cast<size_t>( type )] = 1;
+        stats.bytes = bytes;
+        return stats;
+    }
+
+    /**
+     * Get the number of properties of a type
+     */
+    size_t count( schema::Property_Value_Type type ) const
+    {
+        return type_counts[static_cast<size_t>( type )];
+    }
+
+    /**
+     * Get the number of scalar (non-container) properties
+     */
+    size_t leaf_count() const
+    {
+        return node_count - count( schema::Property_Value_Type::OBJECT )
+                          - count( schema::Property_Value_Type::ARRAY );
+    }
+
+}; // End of Subtree_Stats struct
+
+} // End of tmns::fcs::prop namespace
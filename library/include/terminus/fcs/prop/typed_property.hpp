@@ -16,6 +16,8 @@
 
 // C++ Standard Libraries
 #include <filesystem>
+#include <memory>
+#include <string_view>
 
 // Terminus Libraries
 #include <terminus/error.hpp>
@@ -30,27 +32,85 @@ namespace tmns::fcs::prop {
  */
 template<typename T>
 class Typed_Property : public Property {
+
+        static_assert( is_value_type_v<T>, "Typed_Property requires one of the Value alternatives" );
+
     public:
         using ValueType = T;
 
-        Typed_Property() = default;
+        Typed_Property()
+        {
+            m_hash = content_hash::leaf( value_type_of<T>(), m_value );
+        }
 
         explicit Typed_Property(const std::string& key, const T& value = T{})
-            : Property(key), m_value(value) {}
+            : Property(key), m_value(value)
+        {
+            m_hash = content_hash::leaf( value_type_of<T>(), m_value );
+        }
 
+        /**
+         * Get the approximate memory held by this property and its value
+         */
+        size_t approximate_bytes() const override
+        {
+            return sizeof( Typed_Property ) + payload_bytes( m_value );
+        }
+
+        /**
+         * Copy this property and its value
+         */
+        std::shared_ptr<Property> clone_node( const std::shared_ptr<Property_Arena>& arena,
+                                              uint64_t                               edit ) const override
+        {
+            auto copy = make_node<Typed_Property>( arena, *this );
+            copy->m_edit = edit;
+            return copy;
+        }
+
+        /**
+         * Set the value from a std::any.  Compatibility shim; prefer set_scalar_value.
+         */
         Result<void> set_value(const std::any& value) override
         {
-            try {
-                m_value = std::any_cast<T>(value);
-                return outcome::ok();
-            } catch (const std::bad_any_cast& e) {
+            auto typed_value = std::any_cast<T>( &value );
+            if( typed_value == nullptr ) {
                 return outcome::fail( error::Error_Code::TYPE_MISMATCH,
                                       "Cannot cast value to type " + get_type_string());
             }
+            assign( *typed_value );
+            return outcome::ok();
         }
+
+        /**
+         * Get the value as a std::any.  Compatibility shim; prefer get_scalar_value.
+         */
         Result<std::any> get_value() const override
         {
-            return outcome::ok<std::any>(m_value);
+            return outcome::ok<std::any>( load_value() );
+        }
+
+        /**
+         * Set the value of the property
+         */
+        Result<void> set_scalar_value( const Value& value ) override
+        {
+            auto typed_value = std::get_if<T>( &value );
+            if( typed_value == nullptr ) {
+                return outcome::fail( error::Error_Code::TYPE_MISMATCH,
+                                      "Cannot assign " + schema::type_to_string( value_type( value ) ) +
+                                      " value to type " + get_type_string() );
+            }
+            assign( *typed_value );
+            return outcome::ok();
+        }
+
+        /**
+         * Get the value of the property
+         */
+        Result<Value> get_scalar_value() const override
+        {
+            return outcome::ok<Value>( Value( std::in_place_type<T>, load_value() ) );
         }
 
         /**
@@ -59,7 +119,7 @@ class Typed_Property : public Property {
         Result<void> validate() const override
         {
             if (m_schema) {
-                return m_schema->validate(m_value);
+                return m_schema->validate_value( Value( std::in_place_type<T>, load_value() ) );
             }
             return outcome::ok();
         }
@@ -69,7 +129,7 @@ class Typed_Property : public Property {
          */
         Result<void> set_typed_value(const T& value)
         {
-            m_value = value;
+            assign( value );
             return outcome::ok();
         }
 
@@ -78,9 +138,19 @@ class Typed_Property : public Property {
          */
         Result<T> get_typed_value() const
         {
-            return outcome::ok<T>( m_value );
+            return outcome::ok<T>( load_value() );
         }
 
+        /**
+         * Copy the value out
+         */
+        T load_value() const { return m_value; }
+
+        /**
+         * Borrow the value without copying.  Valid until the value is next set.
+         */
+        const T& typed_value_ref() const { return m_value; }
+
         /**
          * Get the type of the property
          */
@@ -92,6 +162,51 @@ class Typed_Property : public Property {
         std::string get_type_string() const override;
 
     private:
+
+        /**
+         * Heap storage held by a value beyond the property itself
+         */
+        static size_t payload_bytes( const T& value )
+        {
+            if constexpr( std::is_same_v<T, std::string> ) {
+                return string_payload_bytes( value );
+            }
+            else if constexpr( std::is_same_v<T, std::filesystem::path> ) {
+                return string_payload_bytes( value.native() );
+            }
+            else {
+                return 0;
+            }
+        }
+
+        /**
+         * Heap storage of a string, or zero if it fits in the small-string buffer
+         */
+        template <typename String_Type>
+        static size_t string_payload_bytes( const String_Type& value )
+        {
+            return value.capacity() > String_Type().capacity()
+                 ? ( value.capacity() + 1 ) * sizeof( typename String_Type::value_type ) : 0;
+        }
+
+        /**
+         * Store a value, keeping the enclosing byte counts current
+         */
+        void assign( const T& value )
+        {
+            mark_value_changed();
+            update_hash( content_hash::leaf( value_type_of<T>(), value ) );
+            if constexpr( std::is_same_v<T, std::string> || std::is_same_v<T, std::filesystem::path> ) {
+                const auto before = payload_bytes( m_value );
+                m_value = value;
+                adjust_bytes( static_cast<std::ptrdiff_t>( payload_bytes( m_value ) ) -
+                              static_cast<std::ptrdiff_t>( before ) );
+            }
+            else {
+                m_value = value;
+            }
+        }
+
         T m_value{};
 };
 
@@ -191,6 +306,51 @@ inline std::string Typed_Property<std::filesystem::path>::get_type_string() cons
     return "path";
 }
 
+/**
+ * Borrow the typed value of a property.  Returns nullptr if the property is
+ * null or holds another type.
+ */
+template <typename T>
+const T* typed_value_ptr( const Property* property )
+{
+    if( property == nullptr || property->get_type() != value_type_of<T>() ) {
+        return nullptr;
+    }
+    return &static_cast<const Typed_Property<T>*>( property )->typed_value_ref();
+}
+
+/**
+ * Read the typed value of a property found at a path
+ *
+ * @return NOT_FOUND if the property is null, TYPE_MISMATCH if it holds another type
+ */
+template <typename T>
+Result<Read_Type<T>> read_typed_value( const Property* property, std::string_view path )
+{
+    if( property == nullptr ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Property not found: " + std::string( path ) );
+    }
+    if( property->get_type() != value_type_of<T>() ) {
+        return outcome::fail( error::Error_Code::TYPE_MISMATCH,
+                              "Property '" + std::string( path ) + "' is of type " + property->get_type_string() );
+    }
+    return outcome::ok<Read_Type<T>>( static_cast<const Typed_Property<T>*>( property )->typed_value_ref() );
+}
+
+/**
+ * Read the typed value of a property, or the fallback if the property is null
+ * or holds another type
+ */
+template <typename T>
+Read_Type<T> typed_value_or( const Property* property, Read_Type<T> fallback )
+{
+    if( property == nullptr || property->get_type() != value_type_of<T>() ) {
+        return fallback;
+    }
+    return static_cast<const Typed_Property<T>*>( property )->typed_value_ref();
+}
+
 // Type aliases for common property types
 using String_Property  = Typed_Property<std::string>;
 using Integer_Property = Typed_Property<int64_t>;
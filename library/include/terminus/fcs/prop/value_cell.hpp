@@ -0,0 +1,76 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    value_cell.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace tmns::fcs::prop {
+
+/**
+ * Published copy of a watched value that is too large for a Hot_Slot.
+ *
+ * The cell mirrors a property of a Datastore, which stores into it after each
+ * write to the property is published.  Each store publishes a new immutable
+ * copy, so readers on other threads take the current one with a single atomic
+ * load and keep it for as long as they need.
+ */
+template <typename T>
+class Value_Cell
+{
+    public:
+
+        using value_type = T;
+
+        /**
+         * Constructor
+         *
+         * @param value Initial value
+         */
+        explicit Value_Cell( const T& value ) : m_value( std::make_shared<const T>( value ) ) {}
+
+        std::shared_ptr<const T> load() const { return m_value.load( std::memory_order_acquire ); }
+
+        /**
+         * Publish a new value.  Storing the current value again is not counted as a change.
+         */
+        void store( const T& value )
+        {
+            if( *load() == value ) {
+                return;
+            }
+            m_value.store( std::make_shared<const T>( value ), std::memory_order_release );
+            m_changes.fetch_add( 1, std::memory_order_release );
+        }
+
+        /**
+         * Get the number of times the value changed
+         */
+        uint64_t changes() const { return m_changes.load( std::memory_order_acquire ); }
+
+        Value_Cell( const Value_Cell& ) = delete;
+        Value_Cell& operator=( const Value_Cell& ) = delete;
+
+    private:
+
+        std::atomic<std::shared_ptr<const T>> m_value;
+
+        std::atomic<uint64_t> m_changes{ 0 };
+
+}; // End of Value_Cell class
+
+} // namespace tmns::fcs::prop
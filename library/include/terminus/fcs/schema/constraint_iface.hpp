@@ -21,6 +21,9 @@
 // Terminus Libraries
 #include <terminus/error.hpp>
 
+// Project Libraries
+#include <terminus/fcs/value.hpp>
+
 namespace tmns::fcs {
 
 /**
@@ -32,8 +35,20 @@ class Constraint_Iface {
 
         virtual ~Constraint_Iface() = default;
 
+        /**
+         * Validate a std::any.  Compatibility path for callers that do not use Value.
+         */
         virtual Result<void> validate(const std::any& value) const = 0;
 
+        /**
+         * Validate a scalar value.  The default forwards to the std::any overload;
+         * built-in constraints override it to avoid the conversion.
+         */
+        virtual Result<void> validate_value( const Value& value ) const
+        {
+            return validate( value_to_any( value ) );
+        }
+
         virtual std::string description() const = 0;
 };
 
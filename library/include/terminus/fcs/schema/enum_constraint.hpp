@@ -33,9 +33,13 @@ class Enum_Constraint : public Constraint_Iface {
 
         Result<void> validate( const std::any& value ) const override;
 
+        Result<void> validate_value( const Value& value ) const override;
+
         std::string description() const override;
 
     private:
+        Result<void> check_allowed( const std::string& str_value ) const;
+
         std::vector<std::string> m_allowed_values;
 };
 
@@ -42,19 +42,24 @@ class Range_Constraint : public Constraint_Iface {
          * Validate the value
          */
         Result<void> validate( const std::any& value ) const override {
-            try {
-                T typed_value = std::any_cast<T>(value);
-                if (typed_value < m_min_value || typed_value > m_max_value) {
-                    return outcome::fail( error::Error_Code::TYPE_MISMATCH,
-                                          "Value " + std::to_string(typed_value) +
-                                          " is outside range [" + std::to_string(m_min_value) +
-                                          ", " + std::to_string(m_max_value) + "]");
-                }
-                return outcome::ok();
-            } catch (const std::bad_any_cast& e) {
+            auto typed_value = std::any_cast<T>( &value );
+            if( typed_value == nullptr ) {
                 return outcome::fail( error::Error_Code::TYPE_MISMATCH,
                                       "Cannot cast value to numeric type for range validation" );
             }
+            return check_range( *typed_value );
+        }
+
+        /**
+         * Validate a scalar value
+         */
+        Result<void> validate_value( const Value& value ) const override {
+            auto typed_value = std::get_if<T>( &value );
+            if( typed_value == nullptr ) {
+                return outcome::fail( error::Error_Code::TYPE_MISMATCH,
+                                      "Cannot cast value to numeric type for range validation" );
+            }
+            return check_range( *typed_value );
         }
 
         /**
@@ -67,6 +72,16 @@ class Range_Constraint : public Constraint_Iface {
 
     private:
 
+        Result<void> check_range( const T& typed_value ) const {
+            if (typed_value < m_min_value || typed_value > m_max_value) {
+                return outcome::fail( error::Error_Code::TYPE_MISMATCH,
+                                      "Value " + std::to_string(typed_value) +
+                                      " is outside range [" + std::to_string(m_min_value) +
+                                      ", " + std::to_string(m_max_value) + "]");
+            }
+            return outcome::ok();
+        }
+
         T m_min_value;
 
         T m_max_value;
@@ -61,6 +61,7 @@ class Schema {
         const std::vector<std::shared_ptr<Constraint_Iface>>& get_constraints() const;
 
         // Validation
+        Result<void> validate_value( const Value& value ) const;
         Result<void> validate(const std::any& value) const;
         Result<void> validate_property( const prop::Property& property ) const;
 
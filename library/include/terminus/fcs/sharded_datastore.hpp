@@ -0,0 +1,246 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    sharded_datastore.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/result.hpp>
+
+// Project Libraries
+#include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/snapshot.hpp>
+#include <terminus/fcs/value.hpp>
+
+namespace tmns::fcs {
+
+/**
+ * Maps a path to a shard by hashing its leading components
+ */
+class Shard_Router
+{
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param shard_count Number of shards.  Zero is treated as one.
+         * @param key_depth   Number of leading path components that pick the shard.  Zero is treated as one.
+         */
+        Shard_Router( size_t shard_count, size_t key_depth );
+
+        /**
+         * Get the shard holding a path
+         *
+         * @return INVALID_INPUT if the path has fewer components than the key depth
+         */
+        Result<size_t> route( std::string_view path ) const;
+
+        size_t shard_count() const { return m_shard_count; }
+
+        size_t key_depth() const { return m_key_depth; }
+
+    private:
+
+        size_t m_shard_count;
+
+        size_t m_key_depth;
+
+}; // End of Shard_Router class
+
+/**
+ * Consistent cut across every shard of a Sharded_Datastore.
+ *
+ * Holds one immutable Snapshot per shard, all taken at the same instant, so a
+ * reader never sees one shard's write without the writes that completed before
+ * it on other shards.
+ */
+class Sharded_Snapshot
+{
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param router Routing used by the owning datastore
+         * @param shards One snapshot per shard, in shard order
+         */
+        Sharded_Snapshot( Shard_Router router, std::vector<std::shared_ptr<const Snapshot>> shards );
+
+        /**
+         * Get a typed value.  String views are valid while the snapshot is held.
+         *
+         * @return NOT_FOUND if the path is missing, TYPE_MISMATCH if it holds another type
+         */
+        template <typename T>
+        Result<Read_Type<T>> get( std::string_view path ) const
+        {
+            auto shard = find_shard( path );
+            if( !shard ) {
+                return shard.error();
+            }
+            return shard.value()->template get<T>( path );
+        }
+
+        /**
+         * Get a typed value, or the fallback if the path is missing or holds another type
+         */
+        template <typename T>
+        Read_Type<T> get_or( std::string_view path, Read_Type<T> fallback ) const
+        {
+            auto shard = find_shard( path );
+            return shard ? shard.value()->template get_or<T>( path, fallback ) : fallback;
+        }
+
+        /**
+         * Get a scalar value
+         */
+        Result<Value> get_scalar_value( std::string_view path ) const;
+
+        /**
+         * Check if a property exists
+         */
+        bool has_property( std::string_view path ) const;
+
+        /**
+         * Get the snapshot of one shard
+         */
+        const Snapshot& shard( size_t index ) const { return *m_shards.at( index ); }
+
+        size_t shard_count() const { return m_shards.size(); }
+
+    private:
+
+        Result<const Snapshot*> find_shard( std::string_view path ) const;
+
+        Shard_Router m_router;
+
+        std::vector<std::shared_ptr<const Snapshot>> m_shards;
+
+}; // End of Sharded_Snapshot class
+
+/**
+ * Datastore partitioned into independent snapshot-mode shards.
+ *
+ * Each path is routed by a hash of its first `key_depth` components, so with a
+ * depth of 2 `app.database.*` and `app.server.*` may live in different shards.
+ * Every shard has its own writer lock and snapshot chain.  Writers to different
+ * shards never contend, and readers of one shard are not affected by writes to
+ * another.  `snapshot()` briefly locks every shard to take a consistent cut.
+ *
+ * Paths must have at least `key_depth` components.  Objects above that depth
+ * are repeated in each shard that holds a descendant.
+ */
+class Sharded_Datastore
+{
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param shard_count Number of shards
+         * @param key_depth   Number of leading path components that pick the shard
+         */
+        explicit Sharded_Datastore( size_t shard_count = 16, size_t key_depth = 1 );
+
+        /**
+         * Insert a property at a path, creating intermediate objects as needed
+         */
+        Result<void> insert_property( std::string_view path, std::shared_ptr<prop::Property> property );
+
+        /**
+         * Remove a property
+         */
+        Result<void> remove_property( std::string_view path );
+
+        /**
+         * Set a scalar value.  The alternative must match the property type.
+         */
+        Result<void> set_scalar_value( std::string_view path, const Value& value );
+
+        /**
+         * Get a scalar value
+         */
+        Result<Value> get_scalar_value( std::string_view path ) const;
+
+        /**
+         * Set the value of an existing typed property
+         *
+         * @return NOT_FOUND if the path is missing, TYPE_MISMATCH if it holds another type
+         */
+        template <typename T>
+        Result<void> set( std::string_view path, const T& value )
+        {
+            auto shard = route( path );
+            if( !shard ) {
+                return shard.error();
+            }
+            return shard.value()->set<T>( path, value );
+        }
+
+        /**
+         * Get a typed value, or the fallback if the path is missing or holds another type
+         */
+        template <typename T>
+        Read_Type<T> get_or( std::string_view path, Read_Type<T> fallback ) const
+        {
+            auto shard = route( path );
+            return shard ? shard.value()->get_or<T>( path, fallback ) : fallback;
+        }
+
+        /**
+         * Check if a property exists
+         */
+        bool has_property( std::string_view path ) const;
+
+        /**
+         * Take a consistent snapshot of every shard
+         */
+        Sharded_Snapshot snapshot() const;
+
+        /**
+         * Get one shard.  Use it to read a single shard with `snapshot()`, `read()` or `local_view()`.
+         */
+        const Datastore& shard( size_t index ) const { return *m_shards.at( index ); }
+
+        /**
+         * Get the shard index of a path
+         */
+        Result<size_t> shard_index( std::string_view path ) const { return m_router.route( path ); }
+
+        size_t shard_count() const { return m_shards.size(); }
+
+        /**
+         * Get the number of properties across all shards.  O(shard count).
+         *
+         * Objects repeated across shards are counted once per shard.
+         */
+        size_t size() const;
+
+    private:
+
+        Result<Datastore*> route( std::string_view path ) const;
+
+        Shard_Router m_router;
+
+        std::vector<std::unique_ptr<Datastore>> m_shards;
+
+}; // End of Sharded_Datastore class
+
+} // End of tmns::fcs namespace
@@ -0,0 +1,197 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    snapshot.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+// Terminus Libraries
+#include <terminus/outcome/result.hpp>
+
+// Project Libraries
+#include <terminus/fcs/epoch_manager.hpp>
+#include <terminus/fcs/prop/object_property.hpp>
+#include <terminus/fcs/prop/property_view.hpp>
+#include <terminus/fcs/prop/subtree_stats.hpp>
+#include <terminus/fcs/prop/typed_property.hpp>
+#include <terminus/fcs/value.hpp>
+
+namespace tmns::fcs {
+
+/**
+ * Immutable version of a Datastore's property tree.
+ *
+ * Nothing reachable from a published snapshot is modified again; writers copy
+ * the nodes they change and publish a new snapshot.  Any number of threads may
+ * therefore read one snapshot without locks.  Borrowed values and views are
+ * valid for as long as the snapshot is held.
+ */
+class Snapshot
+{
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param root    Root of a tree that will no longer be modified
+         * @param version Publication counter of the owning Datastore
+         */
+        Snapshot( std::shared_ptr<const prop::Object_Property> root, uint64_t version );
+
+        /**
+         * Get the version.  Each publication of a Datastore increments it.
+         */
+        uint64_t version() const { return m_version; }
+
+        /**
+         * Get the root of the tree
+         */
+        const std::shared_ptr<const prop::Object_Property>& get_root() const { return m_root; }
+
+        /**
+         * Borrow the root
+         */
+        prop::Property_View root_view() const { return prop::Property_View( m_root.get() ); }
+
+        /**
+         * Borrow a property.  An empty path views the root.
+         */
+        prop::Property_View view( std::string_view path ) const;
+
+        /**
+         * Get a typed value.  String views are valid while the snapshot is held.
+         *
+         * @return NOT_FOUND if the path is missing, TYPE_MISMATCH if it holds another type
+         */
+        template <typename T>
+        Result<Read_Type<T>> get( std::string_view path ) const
+        {
+            return prop::read_typed_value<T>( find( path ), path );
+        }
+
+        /**
+         * Borrow a typed value.  Returns nullptr if the path is missing or holds another type.
+         */
+        template <typename T>
+        const T* try_get( std::string_view path ) const
+        {
+            return prop::typed_value_ptr<T>( find( path ) );
+        }
+
+        /**
+         * Get a typed value, or the fallback if the path is missing or holds another type
+         */
+        template <typename T>
+        Read_Type<T> get_or( std::string_view path, Read_Type<T> fallback ) const
+        {
+            return prop::typed_value_or<T>( find( path ), fallback );
+        }
+
+        /**
+         * Get a scalar value
+         */
+        Result<Value> get_scalar_value( std::string_view path ) const;
+
+        /**
+         * Get the version of a property, for a later Datastore::compare_and_set()
+         *
+         * @return NOT_FOUND if the path is missing
+         */
+        Result<uint64_t> get_version( std::string_view path ) const;
+
+        /**
+         * Check if a property exists
+         */
+        bool has_property( std::string_view path ) const { return find( path ) != nullptr; }
+
+        /**
+         * Get the number of properties, excluding the root.  O(1).
+         */
+        size_t size() const { return m_root->get_subtree_stats().node_count - 1; }
+
+        /**
+         * Get node counts by type, maximum depth and approximate bytes.  O(1).
+         *
+         * Counts exclude the root object; the byte total includes it.
+         */
+        prop::Subtree_Stats stats() const;
+
+        /**
+         * Get the content hash of the whole tree.  O(1).
+         */
+        uint64_t content_hash() const { return m_root->get_content_hash(); }
+
+    private:
+
+        /**
+         * Find a property without touching reference counts.  Returns nullptr if missing.
+         */
+        const prop::Property* find( std::string_view path ) const;
+
+        std::shared_ptr<const prop::Object_Property> m_root;
+
+        uint64_t m_version;
+
+}; // End of Snapshot class
+
+/**
+ * Snapshot borrowed under an epoch pin.
+ *
+ * Unlike holding a `shared_ptr<const Snapshot>`, taking a guard touches no
+ * shared reference count.  The snapshot stays valid until the guard is
+ * destroyed.  Keep guards short-lived and on the thread that created them,
+ * since a pinned thread delays the release of every retired snapshot.
+ */
+class Snapshot_Guard
+{
+    public:
+
+        /**
+         * Default constructor.  Creates an empty guard.
+         */
+        Snapshot_Guard() = default;
+
+        /**
+         * Constructor
+         *
+         * @param pin      Epoch pin taken before the snapshot pointer was loaded
+         * @param snapshot Snapshot protected by the pin
+         */
+        Snapshot_Guard( Epoch_Manager::Guard pin, const Snapshot* snapshot )
+            : m_pin( std::move( pin ) ), m_snapshot( snapshot ) {}
+
+        /**
+         * Check if the guard refers to a snapshot
+         */
+        explicit operator bool() const { return m_snapshot != nullptr; }
+
+        const Snapshot& operator*() const { return *m_snapshot; }
+
+        const Snapshot* operator->() const { return m_snapshot; }
+
+        const Snapshot* get() const { return m_snapshot; }
+
+    private:
+
+        Epoch_Manager::Guard m_pin;
+
+        const Snapshot* m_snapshot{ nullptr };
+
+}; // End of Snapshot_Guard class
+
+} // End of tmns::fcs namespace
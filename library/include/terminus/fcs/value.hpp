@@ -0,0 +1,97 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    value.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <any>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+// Project Libraries
+#include <terminus/fcs/schema/property_value_type.hpp>
+
+namespace tmns::fcs {
+
+/**
+ * Closed set of scalar property values.
+ *
+ * The alternatives are in the same order as the scalar entries of
+ * `schema::Property_Value_Type`, so `index()` maps directly to the type.
+ */
+using Value = std::variant<std::string,
+                           int64_t,
+                           float,
+                           double,
+                           bool,
+                           std::filesystem::path>;
+
+/**
+ * Check whether a type is one of the Value alternatives
+ */
+template <typename T>
+inline constexpr bool is_value_type_v = std::is_same_v<T, std::string>  ||
+                                        std::is_same_v<T, int64_t>      ||
+                                        std::is_same_v<T, float>        ||
+                                        std::is_same_v<T, double>       ||
+                                        std::is_same_v<T, bool>         ||
+                                        std::is_same_v<T, std::filesystem::path>;
+
+/**
+ * Get the property type of a Value alternative
+ */
+template <typename T>
+constexpr schema::Property_Value_Type value_type_of()
+{
+    static_assert( is_value_type_v<T>, "Not a Value alternative" );
+    if constexpr( std::is_same_v<T, std::string> )  { return schema::Property_Value_Type::STRING; }
+    else if constexpr( std::is_same_v<T, int64_t> ) { return schema::Property_Value_Type::INTEGER; }
+    else if constexpr( std::is_same_v<T, float> )   { return schema::Property_Value_Type::FLOAT; }
+    else if constexpr( std::is_same_v<T, double> )  { return schema::Property_Value_Type::DOUBLE; }
+    else if constexpr( std::is_same_v<T, bool> )    { return schema::Property_Value_Type::BOOLEAN; }
+    else                                            { return schema::Property_Value_Type::PATH; }
+}
+
+/**
+ * Value type returned by the typed readers.  Strings are returned as views.
+ */
+template <typename T>
+using Read_Type = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+/**
+ * Get the property type held by a value
+ */
+inline schema::Property_Value_Type value_type( const Value& value )
+{
+    return static_cast<schema::Property_Value_Type>( value.index() );
+}
+
+/**
+ * Wrap a value in a std::any holding the same alternative
+ */
+std::any value_to_any( const Value& value );
+
+/**
+ * Unwrap a std::any holding one of the Value alternatives.  Does not throw.
+ *
+ * @return std::nullopt if the any is empty or holds another type
+ */
+std::optional<Value> value_from_any( const std::any& value );
+
+} // End of tmns::fcs namespace
@@ -84,9 +84,9 @@ class Config_File_Parser_Impl {
                                       Datastore& datastore );
 
         /**
-         * Convert TOML value to std::any
+         * Convert a TOML scalar to a Value
          */
-        Result<std::any> toml_value_to_any( const toml::node& value );
+        Result<Value> toml_value_to_value( const toml::node& value );
 
         /**
          * Validate a property against schema if provided
@@ -17,97 +17,1102 @@
 // C++ Standard Libraries
 #include <sstream>
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <unordered_map>
 
 // Terminus Libraries
+#include <terminus/fcs/diff.hpp>
 #include <terminus/fcs/prop/array_property.hpp>
 #include <terminus/fcs/prop/object_property.hpp>
 #include <terminus/fcs/prop/typed_property.hpp>
 
 namespace tmns::fcs {
 
+/**
+ * Get a new edit token.  Tokens are unique across datastores, because trees may share nodes.
+ */
+static uint64_t next_edit()
+{
+    static std::atomic<uint64_t> s_edit{ 1 };
+    return s_edit.fetch_add( 1, std::memory_order_relaxed );
+}
+
 /******************************/
 /*         Constructor        */
 /******************************/
-Datastore::Datastore() : m_root( std::make_shared<prop::Object_Property>("root") )
-{}
+Datastore::Datastore()
+  : m_arena( std::make_shared<prop::Property_Arena>() ),
+    m_root( make_property<prop::Object_Property>( "root" ) )
+{
+    commit_index();
+}
 
 /******************************/
 /*         Constructor        */
 /******************************/
-Datastore::Datastore( std::shared_ptr<prop::Object_Property> root ) : m_root(root) {
+Datastore::Datastore( std::shared_ptr<prop::Object_Property> root )
+  : m_arena( std::make_shared<prop::Property_Arena>() ),
+    m_root(root)
+{
     if (!m_root) {
-        m_root = std::make_shared<prop::Object_Property>("root");
+        m_root = make_property<prop::Object_Property>("root");
+    }
+    sync_index();
+}
+
+/******************************/
+/*         Constructor        */
+/******************************/
+Datastore::Datastore( Concurrency concurrency )
+  : Datastore()
+{
+    if( concurrency == Concurrency::SNAPSHOT ) {
+        m_publication = std::make_unique<Publication>();
+        m_publication->edit = next_edit();
+        publish();
+    }
+}
+
+/******************************/
+/*            Clone           */
+/******************************/
+Datastore Datastore::clone()
+{
+    auto guard = lock();
+    Datastore copy( get_concurrency() );
+    if( m_publication ) {
+        auto current = m_publication->current.load( std::memory_order_relaxed );
+        copy.m_root = std::const_pointer_cast<prop::Object_Property>( current->get_root() );
+        copy.publish();
+        return copy;
+    }
+
+    // Every node reachable now is shared, so both sides copy before writing
+    m_write.shared_edit      = next_edit();
+    copy.m_write.shared_edit = next_edit();
+    copy.m_root = m_root;
+    return copy;
+}
+
+/******************************/
+/*          Snapshot          */
+/******************************/
+std::shared_ptr<const Snapshot> Datastore::snapshot() const
+{
+    if( !m_publication ) {
+        return nullptr;
+    }
+    return m_publication->snapshot.load( std::memory_order_acquire );
+}
+
+/******************************/
+/*            Read            */
+/******************************/
+Snapshot_Guard Datastore::read() const
+{
+    if( !m_publication ) {
+        return Snapshot_Guard();
     }
+    auto pin = Epoch_Manager::instance().pin();
+    return Snapshot_Guard( std::move( pin ), m_publication->current.load( std::memory_order_seq_cst ) );
+}
+
+/******************************/
+/*         Local View         */
+/******************************/
+Datastore::Local_View Datastore::local_view() const
+{
+    if( !m_publication ) {
+        return Local_View();
+    }
+    return Local_View( m_publication.get() );
+}
+
+/******************************/
+/*   Publication Destructor   */
+/******************************/
+Datastore::Publication::~Publication()
+{
+    auto& epochs = Epoch_Manager::instance();
+    epochs.retire( snapshot.exchange( nullptr ) );
+    epochs.reclaim();
 }
 
 /******************************/
 /*         Set Property       */
 /******************************/
-Result<void> Datastore::set_property( const std::string& path, const std::any& value ) {
-    return m_root->set_path_value( path, value );
+Result<void> Datastore::set_property( std::string_view path, const std::any& value ) {
+    if( prop::Path_Segments( path ).empty() ) {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Cannot set value on empty path" );
+    }
+
+    Write_Scope scope( *this );
+    auto target = writable( path );
+    if( target == nullptr ) {
+        return m_root->resolve_path( path ).error();
+    }
+    return scope.finish( target->set_value( value ), path );
+}
+
+/******************************/
+/*      Set Scalar Value      */
+/******************************/
+Result<void> Datastore::set_scalar_value( std::string_view path, const Value& value )
+{
+    if( prop::Path_Segments( path ).empty() ) {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Cannot set value on empty path" );
+    }
+
+    Write_Scope scope( *this );
+    auto target = writable( path );
+    if( target == nullptr ) {
+        return m_root->resolve_path( path ).error();
+    }
+    return scope.finish( target->set_scalar_value( value ), path );
+}
+
+/******************************/
+/*      Get Scalar Value      */
+/******************************/
+Result<Value> Datastore::get_scalar_value( std::string_view path ) const
+{
+    auto guard = lock();
+    auto prop_result = find_property( path );
+    if( !prop_result ) {
+        return prop_result.error();
+    }
+    return prop_result.value()->get_scalar_value();
+}
+
+/******************************/
+/*       Enable History       */
+/******************************/
+Result<void> Datastore::enable_history( size_t depth )
+{
+    if( !m_publication ) {
+        return outcome::fail( error::Error_Code::NOT_SUPPORTED,
+                              "Version history requires Concurrency::SNAPSHOT" );
+    }
+    auto guard = lock();
+    auto& history = m_publication->history;
+    if( history.empty() && depth != 0 ) {
+        history.push_back( m_publication->snapshot.load( std::memory_order_relaxed ) );
+    }
+    while( history.size() > depth ) {
+        history.pop_front();
+    }
+    m_publication->history_depth = depth;
+    return outcome::ok();
+}
+
+/******************************/
+/*           Version          */
+/******************************/
+uint64_t Datastore::version() const
+{
+    return m_publication ? m_publication->latest_version.load( std::memory_order_acquire ) : 0;
+}
+
+/******************************/
+/*           History          */
+/******************************/
+std::vector<std::shared_ptr<const Snapshot>> Datastore::history() const
+{
+    if( !m_publication ) {
+        return {};
+    }
+    auto guard = lock();
+    return { m_publication->history.begin(), m_publication->history.end() };
+}
+
+/******************************/
+/*          Checkout          */
+/******************************/
+Result<void> Datastore::checkout( uint64_t version )
+{
+    Write_Scope scope( *this );
+    if( !m_publication || m_publication->history_depth == 0 ) {
+        return outcome::fail( error::Error_Code::NOT_SUPPORTED,
+                              "Version history is not enabled" );
+    }
+
+    const auto& history = m_publication->history;
+    auto found = std::find_if( history.begin(), history.end(), [&]( const auto& snapshot ) {
+        return snapshot->version() == version;
+    });
+    if( found == history.end() ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Version " + std::to_string( version ) + " is no longer retained" );
+    }
+
+    // Swap in the old tree; only the paths that differ are notified, and the
+    // listeners below an added, removed or retyped subtree are found from its top
+    auto root = std::const_pointer_cast<prop::Object_Property>( ( *found )->get_root() );
+    diff_trees( *m_root, *root, [&]( Change_Kind,
+                                     std::string_view      changed_path,
+                                     const prop::Property*,
+                                     const prop::Property* ) {
+        m_write.changed.emplace_back( changed_path );
+    });
+    m_root = std::move( root );
+    m_write.cursor.reset();
+    sync_index();
+    return scope.finish( outcome::ok() );
+}
+
+/******************************/
+/*          Rollback          */
+/******************************/
+Result<void> Datastore::rollback( size_t steps )
+{
+    auto guard = lock();
+    if( !m_publication || m_publication->history_depth == 0 ) {
+        return outcome::fail( error::Error_Code::NOT_SUPPORTED,
+                              "Version history is not enabled" );
+    }
+
+    const auto& history = m_publication->history;
+    if( steps >= history.size() ) {
+        return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
+                              "Only " + std::to_string( history.size() - 1 ) + " earlier versions are retained" );
+    }
+    return checkout( history[history.size() - 1 - steps]->version() );
+}
+
+/******************************/
+/*         Get Version        */
+/******************************/
+Result<uint64_t> Datastore::get_version( std::string_view path ) const
+{
+    auto guard = lock();
+    auto found = lookup( path );
+    if( found == nullptr ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Property not found: " + std::string( path ) );
+    }
+    return outcome::ok<uint64_t>( ( *found )->get_version() );
+}
+
+/******************************/
+/*       Compare And Set      */
+/******************************/
+Result<bool> Datastore::compare_and_set( std::string_view path, uint64_t expected_version, const Value& value )
+{
+    Write_Scope scope( *this );
+    auto matched = check_version( path, expected_version, value );
+    if( !matched || !matched.value() ) {
+        return matched;
+    }
+
+    auto target = writable( path );
+    auto result = scope.finish( target->set_scalar_value( value ), path );
+    if( !result ) {
+        return result.error();
+    }
+    return outcome::ok<bool>( true );
+}
+
+/******************************/
+/*    Bulk Compare And Set    */
+/******************************/
+Result<bool> Datastore::compare_and_set( const std::vector<Versioned_Write>& writes )
+{
+    Write_Scope scope( *this, true );
+
+    // Every write is checked before any is applied, so none of them can fail part way
+    for( const auto& write : writes ) {
+        auto matched = check_version( write.path, write.expected_version, write.value );
+        if( !matched || !matched.value() ) {
+            return matched;
+        }
+    }
+    for( const auto& write : writes ) {
+        auto result = set_scalar_value( write.path, write.value );
+        if( !result ) {
+            return result.error();
+        }
+    }
+
+    // Validated like a transaction; a failure rolls every write back
+    auto validated = validate_changed();
+    if( !validated ) {
+        return validated.error();
+    }
+    auto result = scope.finish( outcome::ok() );
+    if( !result ) {
+        return result.error();
+    }
+    return outcome::ok<bool>( true );
+}
+
+/******************************/
+/*        Check Version       */
+/******************************/
+Result<bool> Datastore::check_version( std::string_view path,
+                                       uint64_t         expected_version,
+                                       const Value&     value ) const
+{
+    auto found = lookup( path );
+    if( found == nullptr ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Property not found: " + std::string( path ) );
+    }
+
+    const auto& property = **found;
+    if( property.get_type() != value_type( value ) ) {
+        return outcome::fail( error::Error_Code::TYPE_MISMATCH,
+                              "Cannot assign " + schema::type_to_string( value_type( value ) ) +
+                              " value to type " + property.get_type_string() );
+    }
+    return outcome::ok<bool>( property.get_version() == expected_version );
+}
+
+/******************************/
+/*         Transaction        */
+/******************************/
+Datastore::Transaction Datastore::transaction()
+{
+    return Transaction( *this );
+}
+
+/******************************/
+/*     Transaction Commit     */
+/******************************/
+Result<void> Datastore::Transaction::commit()
+{
+    auto operations = std::move( m_operations );
+    m_operations.clear();
+
+    auto& datastore = m_datastore;
+    Write_Scope scope( datastore, true );
+    for( auto& operation : operations ) {
+        const auto& path = operation.path;
+        Result<void> result;
+        switch( operation.payload.index() ) {
+            case 0:
+                result = datastore.remove_property( path );
+                break;
+            case 1:
+                result = datastore.set_scalar_value( path, std::get<Value>( operation.payload ) );
+                break;
+            case 2:
+                result = datastore.set_property( path, std::get<std::any>( operation.payload ) );
+                break;
+            default:
+                result = datastore.insert_property( path, std::move( std::get<3>( operation.payload ) ) );
+                break;
+        }
+        if( !result ) {
+            return result;
+        }
+    }
+
+    auto validated = datastore.validate_changed();
+    if( !validated ) {
+        return validated;
+    }
+    return scope.finish( outcome::ok() );
+}
+
+/******************************/
+/*      Validate Changed      */
+/******************************/
+Result<void> Datastore::validate_changed() const
+{
+    // Each changed property is validated once, against the final tree
+    std::unordered_map<std::string_view, bool> validated;
+    for( const auto& path : m_write.changed ) {
+        if( !validated.emplace( path, true ).second ) {
+            continue;
+        }
+        if( auto found = lookup( path ) ) {
+            auto result = ( *found )->validate();
+            if( !result ) {
+                return result;
+            }
+        }
+    }
+    return outcome::ok();
+}
+
+/******************************/
+/*     Add Change Listener    */
+/******************************/
+Result<notify::Listener_Id> Datastore::add_change_listener( std::string_view        pattern,
+                                                            notify::Change_Callback callback )
+{
+    return m_listeners->add( pattern, std::move( callback ) );
+}
+
+/******************************/
+/*   Remove Change Listener   */
+/******************************/
+bool Datastore::remove_change_listener( notify::Listener_Id id )
+{
+    return m_listeners->remove( id );
+}
+
+/******************************/
+/*    Enable Async Dispatch   */
+/******************************/
+Result<void> Datastore::enable_async_dispatch( size_t queue_capacity )
+{
+    if( !m_publication ) {
+        return outcome::fail( error::Error_Code::NOT_SUPPORTED,
+                              "Asynchronous dispatch requires Concurrency::SNAPSHOT" );
+    }
+    // The old dispatcher drains its queue when released, which must happen unlocked
+    auto dispatcher = std::make_shared<notify::Async_Dispatcher>( *m_listeners, queue_capacity );
+    {
+        auto guard = lock();
+        std::swap( dispatcher, m_dispatcher );
+    }
+    return outcome::ok();
+}
+
+/******************************/
+/*   Disable Async Dispatch   */
+/******************************/
+void Datastore::disable_async_dispatch()
+{
+    std::shared_ptr<notify::Async_Dispatcher> dispatcher;
+    {
+        auto guard = lock();
+        std::swap( dispatcher, m_dispatcher );
+    }
+}
+
+/******************************/
+/*     Flush Notifications    */
+/******************************/
+void Datastore::flush_notifications() const
+{
+    std::shared_ptr<notify::Async_Dispatcher> dispatcher;
+    {
+        auto guard = lock();
+        dispatcher = m_dispatcher;
+    }
+
+    // Wait unlocked so listeners can still read and write the datastore
+    if( dispatcher ) {
+        dispatcher->flush();
+    }
+}
+
+/******************************/
+/*       Dispatch Stats       */
+/******************************/
+notify::Dispatch_Stats Datastore::dispatch_stats() const
+{
+    std::shared_ptr<notify::Async_Dispatcher> dispatcher;
+    {
+        auto guard = lock();
+        dispatcher = m_dispatcher;
+    }
+    return dispatcher ? dispatcher->stats() : notify::Dispatch_Stats();
 }
 
 /******************************/
 /*         Get Property       */
 /******************************/
-Result<std::shared_ptr<prop::Property>> Datastore::get_property(const std::string& path) const {
-    return m_root->resolve_path(path);
+Result<std::shared_ptr<prop::Property>> Datastore::get_property( std::string_view path ) const {
+    if( m_publication ) {
+        return outcome::fail( error::Error_Code::NOT_SUPPORTED,
+                              "Snapshot-mode properties are shared and read-only; use read_property(): " + std::string( path ) );
+    }
+    return find_property( path );
+}
+
+/******************************/
+/*        Find Property       */
+/******************************/
+Result<std::shared_ptr<prop::Property>> Datastore::find_property( std::string_view path ) const
+{
+    auto guard = lock();
+    if( auto found = lookup( path ) ) {
+        return outcome::ok<std::shared_ptr<prop::Property>>( *found );
+    }
+
+    // Walk again for a precise error, or the root for an empty path
+    return m_root->resolve_path( path );
+}
+
+/******************************/
+/*        Read Property       */
+/******************************/
+Result<std::shared_ptr<const prop::Property>> Datastore::read_property( std::string_view path ) const
+{
+    if( m_publication ) {
+        // The pointer shares ownership of the snapshot, which keeps the node alive
+        auto published = snapshot();
+        const prop::Property* found = path.empty() ? published->get_root().get() : published->view( path ).get();
+        if( found == nullptr ) {
+            return outcome::fail( error::Error_Code::NOT_FOUND,
+                                  "Property not found: " + std::string( path ) );
+        }
+        return outcome::ok<std::shared_ptr<const prop::Property>>( std::shared_ptr<const prop::Property>( published, found ) );
+    }
+
+    auto guard = lock();
+    if( auto found = lookup( path ) ) {
+        return outcome::ok<std::shared_ptr<const prop::Property>>( *found );
+    }
+    auto result = m_root->resolve_path( path );
+    if( !result ) {
+        return result.error();
+    }
+    return outcome::ok<std::shared_ptr<const prop::Property>>( result.value() );
+}
+
+/******************************/
+/*           Lookup           */
+/******************************/
+const std::shared_ptr<prop::Property>* Datastore::lookup( std::string_view path ) const
+{
+    // Non-canonical spellings of a path miss the index and are walked
+    if( index_current() ) {
+        if( auto indexed = m_index.find( path ) ) {
+            return indexed;
+        }
+    }
+    return m_root->find_path( path );
+}
+
+/******************************/
+/*            Lock            */
+/******************************/
+std::unique_lock<std::recursive_mutex> Datastore::lock() const
+{
+    if( !m_publication ) {
+        return {};
+    }
+    return std::unique_lock<std::recursive_mutex>( m_publication->mutex );
+}
+
+/******************************/
+/*        Writable Root       */
+/******************************/
+prop::Object_Property* Datastore::writable_root()
+{
+    sync_index();
+    const auto edit = write_edit();
+    if( edit != 0 && m_root->get_edit() != edit ) {
+        m_root = std::static_pointer_cast<prop::Object_Property>( m_root->clone_node( m_arena, edit ) );
+        commit_index();
+    }
+    return m_root.get();
+}
+
+/******************************/
+/*          Writable          */
+/******************************/
+prop::Property* Datastore::writable( std::string_view path )
+{
+    const auto edit = write_edit();
+    if( edit == 0 ) {
+        auto found = lookup( path );
+        return found ? found->get() : nullptr;
+    }
+
+    // Nodes already copied in this edit stay valid until the tree changes shape
+    prop::Property* current = writable_root();
+    auto& cursor = m_write.cursor;
+    if( cursor.edit != edit || cursor.root != current ) {
+        cursor.reset();
+        cursor.edit = edit;
+        cursor.root = current;
+    }
+
+    prop::Path_Segments segments( path );
+    auto segment = segments.begin();
+    size_t depth = 0;
+    for( ; segment != segments.end() && depth < cursor.nodes.size(); ++segment, ++depth ) {
+        const size_t begin = depth == 0 ? 0 : cursor.ends[depth - 1] + 1;
+        if( std::string_view( cursor.path ).substr( begin, cursor.ends[depth] - begin ) != *segment ) {
+            break;
+        }
+        current = cursor.nodes[depth];
+    }
+    cursor.nodes.resize( depth );
+    cursor.ends.resize( depth );
+    cursor.path.resize( depth == 0 ? 0 : cursor.ends.back() );
+
+    // Copy each remaining published node on the path so the snapshots holding it are unaffected
+    for( ; segment != segments.end(); ++segment ) {
+        if( current->get_type() != schema::Property_Value_Type::OBJECT ) {
+            return nullptr;
+        }
+        auto found = static_cast<prop::Object_Property*>( current )->writable_child( *segment, m_arena, edit );
+        if( found == nullptr ) {
+            return nullptr;
+        }
+
+        cursor.path.append( cursor.path.empty() ? "" : "." ).append( *segment );
+        if( auto indexed = m_index.find( cursor.path ); indexed != nullptr && indexed->get() != found->get() ) {
+            m_index.insert( cursor.path, *found );
+        }
+        current = found->get();
+        cursor.ends.push_back( cursor.path.size() );
+        cursor.nodes.push_back( current );
+    }
+    if( current == m_root.get() ) {
+        return nullptr;
+    }
+    return current;
+}
+
+/******************************/
+/*         Begin Batch        */
+/******************************/
+void Datastore::begin_batch()
+{
+    if( !m_publication ) {
+        m_write.batch_edit = next_edit();
+        m_write.batch_base = m_root;
+    }
+}
+
+/******************************/
+/*          End Batch         */
+/******************************/
+void Datastore::end_batch()
+{
+    m_write.batch_edit = 0;
+    m_write.batch_base.reset();
+    m_write.changed.clear();
+    m_write.cursor.reset();
+}
+
+/******************************/
+/*        Notify Change       */
+/******************************/
+void Datastore::notify_change( std::string_view path )
+{
+    if( m_listeners->empty() ) {
+        return;
+    }
+    auto found = lookup( path );
+    if( m_dispatcher ) {
+        m_dispatcher->post( std::string( path ), found ? *found : nullptr );
+        return;
+    }
+    m_listeners->dispatch( path, found ? found->get() : nullptr );
+}
+
+/******************************/
+/*       Notify Changes       */
+/******************************/
+void Datastore::notify_changes( std::vector<std::string> changed, std::string_view path )
+{
+    if( m_listeners->empty() ) {
+        return;
+    }
+    if( !path.empty() ) {
+        changed.emplace_back( path );
+    }
+
+    // Each path is reported once, in the order it was last changed
+    std::unordered_map<std::string_view, size_t> last;
+    for( size_t i = 0; i < changed.size(); ++i ) {
+        last[changed[i]] = i;
+    }
+
+    // A path below another changed path is reported by that path's dispatch
+    auto covered = [&]( std::string_view path ) {
+        for( auto dot = path.rfind( '.' ); dot != std::string_view::npos; dot = path.rfind( '.', dot - 1 ) ) {
+            if( last.count( path.substr( 0, dot ) ) != 0 ) {
+                return true;
+            }
+            if( dot == 0 ) {
+                break;
+            }
+        }
+        return false;
+    };
+    for( size_t i = 0; i < changed.size(); ++i ) {
+        if( last[changed[i]] == i && !covered( changed[i] ) ) {
+            notify_change( changed[i] );
+        }
+    }
+}
+
+/******************************/
+/*       Canonical Path       */
+/******************************/
+std::string Datastore::canonical_path( std::string_view path )
+{
+    std::string canonical;
+    canonical.reserve( path.size() );
+    for( auto segment : prop::Path_Segments( path ) ) {
+        canonical.append( canonical.empty() ? "" : "." ).append( segment );
+    }
+    return canonical;
+}
+
+/******************************/
+/*     Refresh Live Values    */
+/******************************/
+void Datastore::refresh_live_values( const std::vector<std::string>& changed, std::string_view path )
+{
+    if( m_live.empty() ) {
+        return;
+    }
+    for( const auto& changed_path : changed ) {
+        refresh_live_subtree( canonical_path( changed_path ) );
+    }
+    if( !path.empty() ) {
+        refresh_live_subtree( canonical_path( path ) );
+    }
+}
+
+/******************************/
+/*    Refresh Live Subtree    */
+/******************************/
+void Datastore::refresh_live_subtree( std::string_view path )
+{
+    auto entry = m_live.lower_bound( path );
+    while( entry != m_live.end() && entry->first.starts_with( path ) ) {
+        const auto& entry_path = entry->first;
+        if( !path.empty() && entry_path.size() != path.size() && entry_path[path.size()] != '.' ) {
+            ++entry;
+            continue;
+        }
+
+        // Nobody can read a value no handle refers to
+        const bool unused = std::visit( []( const auto& live ) { return live.use_count() == 1; }, entry->second );
+        if( unused ) {
+            entry = m_live.erase( entry );
+            continue;
+        }
+
+        // A missing or retyped property leaves the last value in place
+        auto found = lookup( entry_path );
+        std::visit( [&]( const auto& live ) {
+            using Value_Type = typename std::decay_t<decltype( *live )>::value_type;
+            if( auto value = prop::typed_value_ptr<Value_Type>( found ? found->get() : nullptr ) ) {
+                live->store( *value );
+            }
+        }, entry->second );
+        ++entry;
+    }
+}
+
+/******************************/
+/*           Discard          */
+/******************************/
+void Datastore::discard()
+{
+    if( m_write.batch_base ) {
+        m_root = std::move( m_write.batch_base );
+        m_index_generation = 0;
+        sync_index();
+        return;
+    }
+    if( !m_publication ) {
+        return;
+    }
+
+    // Drop the private copies; the index is rebuilt since it may point at them
+    auto current = m_publication->current.load( std::memory_order_relaxed );
+    if( current != nullptr && current->get_root() != m_root ) {
+        m_root = std::const_pointer_cast<prop::Object_Property>( current->get_root() );
+        m_index_generation = 0;
+        sync_index();
+    }
+}
+
+/******************************/
+/*           Publish          */
+/******************************/
+void Datastore::publish()
+{
+    if( !m_publication ) {
+        return;
+    }
+    auto current = m_publication->current.load( std::memory_order_relaxed );
+    if( current != nullptr && current->get_root() == m_root ) {
+        return;
+    }
+
+    const auto version = m_publication->version++;
+    auto next = std::make_shared<const Snapshot>( m_root, version );
+    if( m_publication->history_depth != 0 ) {
+        m_publication->history.push_back( next );
+        while( m_publication->history.size() > m_publication->history_depth ) {
+            m_publication->history.pop_front();
+        }
+    }
+    m_publication->current.store( next.get(), std::memory_order_seq_cst );
+    auto previous = m_publication->snapshot.exchange( std::move( next ), std::memory_order_acq_rel );
+    m_publication->latest_version.store( version, std::memory_order_release );
+
+    // Everything reachable from a snapshot is now frozen; later writes copy what they touch
+    m_publication->edit = next_edit();
+
+    // Pinned readers may still hold the previous snapshot
+    auto& epochs = Epoch_Manager::instance();
+    epochs.retire( std::move( previous ) );
+    epochs.reclaim();
 }
 
 /********************************/
 /*         Remove Property      */
 /********************************/
-Result<void> Datastore::remove_property( const std::string& path )
+Result<void> Datastore::remove_property( std::string_view path )
 {
-    auto path_parts = split_path(path);
-    if (path_parts.empty()) {
+    // Split off the last component; everything before it names the parent
+    auto trimmed = path.substr( 0, path.find_last_not_of( '.' ) + 1 );
+    auto split   = trimmed.rfind( '.' );
+
+    std::string_view parent_path = split == std::string_view::npos ? std::string_view{} : trimmed.substr( 0, split );
+    std::string_view leaf        = split == std::string_view::npos ? trimmed : trimmed.substr( split + 1 );
+    if( leaf.empty() ) {
         return outcome::fail( error::Error_Code::NOT_FOUND,
                               "Cannot remove root property" );
     }
 
-    if( path_parts.size() == 1 ) {
-        return m_root->remove_property( path_parts[0] );
+    Write_Scope scope( *this );
+    auto parent = prop::Path_Segments( parent_path ).empty() ? writable_root() : writable( parent_path );
+    m_write.cursor.reset();
+    if( parent == nullptr ) {
+        return m_root->resolve_path( parent_path ).error();
     }
 
-    // Navigate to parent
-    std::string parent_path = std::string( path.begin(),
-                                           path.end() - static_cast<long>(path_parts.back().length()) - 1 );
-    auto parent_result = get_property( parent_path );
-    if (!parent_result) {
-        return parent_result.error();
+    if( parent->get_type() != schema::Property_Value_Type::OBJECT ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Parent path is not an object" );
     }
 
-    auto parent_obj = std::dynamic_pointer_cast<prop::Object_Property>( parent_result.value() );
-    if (!parent_obj) {
+    auto parent_obj = static_cast<prop::Object_Property*>( parent );
+    auto child      = parent_obj->get_property( leaf );
+    if( !child ) {
         return outcome::fail( error::Error_Code::NOT_FOUND,
-                              "Parent path is not an object" );
+                              "Child property not found: " + std::string( leaf ) );
     }
 
-    return parent_obj->remove_property( path_parts.back() );
+    auto result = parent_obj->remove_property( leaf );
+    if( result ) {
+        auto child_path = canonical_path( path );
+        unindex_subtree( child_path, *child.value() );
+        commit_index();
+    }
+    return scope.finish( result, path );
+}
+
+/********************************/
+/*         Insert Property      */
+/********************************/
+Result<void> Datastore::insert_property( std::string_view                path,
+                                         std::shared_ptr<prop::Property> property )
+{
+    if( !property ) {
+        return outcome::fail( error::Error_Code::UNINITIALIZED,
+                              "Cannot insert null property" );
+    }
+    Write_Scope scope( *this );
+    m_write.cursor.reset();
+
+    // Walk to the parent, creating objects along the way
+    const auto edit = write_edit();
+    prop::Object_Property* current = writable_root();
+    std::string current_path;
+    std::string_view leaf;
+    for( auto segment : prop::Path_Segments( path ) ) {
+        if( !leaf.empty() ) {
+            current_path += current_path.empty() ? "" : ".";
+            current_path += leaf;
+
+            auto next = edit != 0 ? current->writable_child( leaf, m_arena, edit )
+                                  : current->find_path( leaf );
+            if( next == nullptr ) {
+                auto object = make_property<prop::Object_Property>( std::string( leaf ) );
+                auto add_result = current->add_property( object );
+                if( !add_result ) {
+                    return add_result;
+                }
+                m_index.insert( current_path, object );
+                current = object.get();
+            }
+            else if( (*next)->get_type() != schema::Property_Value_Type::OBJECT ) {
+                return outcome::fail( error::Error_Code::TYPE_MISMATCH,
+                                      "Expected object property at: " + std::string( leaf ) );
+            }
+            else {
+                if( edit != 0 ) {
+                    m_index.insert( current_path, *next );
+                }
+                current = static_cast<prop::Object_Property*>( next->get() );
+            }
+        }
+        leaf = segment;
+    }
+    if( leaf.empty() ) {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Cannot insert property at empty path" );
+    }
+
+    std::string leaf_path = current_path.empty() ? std::string( leaf )
+                                                 : current_path + "." + std::string( leaf );
+
+    // Anything being replaced takes its descendants out of the index
+    if( auto existing = current->get_property( leaf ) ) {
+        unindex_subtree( leaf_path, *existing.value() );
+    }
+
+    auto key_result = property->set_key( leaf );
+    if( !key_result ) {
+        return key_result;
+    }
+    auto add_result = current->add_property( property );
+    if( !add_result ) {
+        return add_result;
+    }
+
+    index_subtree( leaf_path, property );
+    commit_index();
+    return scope.finish( outcome::ok(), path );
+}
+
+/********************************/
+/*         Compile Path         */
+/********************************/
+Path_Handle Datastore::compile_path( std::string_view path ) const
+{
+    Path_Handle handle;
+    handle.m_path = path;
+
+    // Interning up front lets the handle resolve paths created later.  A key the
+    // full pool cannot take can never be created, so its handle never resolves.
+    auto& pool = prop::Key_Pool::instance();
+    for( auto segment : prop::Path_Segments( path ) ) {
+        auto atom = pool.intern( segment );
+        handle.m_segments.push_back( atom ? atom.value() : prop::NO_KEY_ATOM );
+    }
+    return handle;
+}
+
+/********************************/
+/*     Set Property (Handle)    */
+/********************************/
+Result<void> Datastore::set_property( const Path_Handle& handle, const std::any& value )
+{
+    // Cached nodes may be shared with snapshots, so write through the path instead
+    if( write_edit() != 0 ) {
+        return set_property( handle.m_path, value );
+    }
+
+    Write_Scope scope( *this );
+    auto prop_result = find_property( handle );
+    if( !prop_result ) {
+        return prop_result.error();
+    }
+    return scope.finish( prop_result.value()->set_value( value ), handle.m_path );
+}
+
+/********************************/
+/*     Get Property (Handle)    */
+/********************************/
+Result<std::shared_ptr<prop::Property>> Datastore::get_property( const Path_Handle& handle ) const
+{
+    if( m_publication ) {
+        return outcome::fail( error::Error_Code::NOT_SUPPORTED,
+                              "Snapshot-mode properties are shared and read-only; use read_property(): " + handle.m_path );
+    }
+    return find_property( handle );
+}
+
+/********************************/
+/*    Find Property (Handle)    */
+/********************************/
+Result<std::shared_ptr<prop::Property>> Datastore::find_property( const Path_Handle& handle ) const
+{
+    auto guard = lock();
+
+    // Reuse the cached resolution until the tree changes shape
+    if( handle.m_cached_root == m_root.get() &&
+        handle.m_cached_generation == m_root->get_structure_generation() )
+    {
+        return outcome::ok<std::shared_ptr<prop::Property>>( handle.m_cached_property );
+    }
+
+    auto result = m_root->resolve_path( handle.m_segments );
+    if( !result ) {
+        handle.m_cached_root = nullptr;
+        handle.m_cached_property.reset();
+        return result;
+    }
+
+    handle.m_cached_root       = m_root.get();
+    handle.m_cached_generation = m_root->get_structure_generation();
+    handle.m_cached_property   = result.value();
+    return result;
+}
+
+/********************************/
+/*             View             */
+/********************************/
+prop::Property_View Datastore::view( std::string_view path ) const
+{
+    auto guard = lock();
+    if( prop::Path_Segments( path ).empty() ) {
+        return root_view();
+    }
+    auto found = lookup( path );
+    return prop::Property_View( found ? found->get() : nullptr );
+}
+
+/********************************/
+/*         View (Handle)        */
+/********************************/
+prop::Property_View Datastore::view( const Path_Handle& handle ) const
+{
+    auto guard = lock();
+    if( handle.m_cached_root == m_root.get() &&
+        handle.m_cached_generation == m_root->get_structure_generation() )
+    {
+        return prop::Property_View( handle.m_cached_property.get() );
+    }
+
+    // Resolve once to fill the handle's cache
+    auto result = find_property( handle );
+    return prop::Property_View( result ? result.value().get() : nullptr );
+}
+
+/********************************/
+/*           Root View          */
+/********************************/
+prop::Property_View Datastore::root_view() const
+{
+    auto guard = lock();
+    return prop::Property_View( m_root.get() );
 }
 
 /********************************/
 /*         Set Schema           */
 /********************************/
-Result<void> Datastore::set_schema( const std::string& path,
+Result<void> Datastore::set_schema( std::string_view path,
                                      std::optional<schema::Schema> schema )
 {
-    auto prop_result = get_property( path );
-    if (!prop_result) {
-        return prop_result.error();
+    Write_Scope scope( *this );
+    auto target = prop::Path_Segments( path ).empty() ? writable_root() : writable( path );
+    if( target == nullptr ) {
+        return m_root->resolve_path( path ).error();
     }
 
-    prop_result.value()->set_schema(std::move(schema));
-    return outcome::ok();
+    target->set_schema(std::move(schema));
+    return scope.finish( outcome::ok() );
 }
 
 /********************************/
 /*         Get Schema           */
 /********************************/
-Result<std::optional<schema::Schema>> Datastore::get_schema( const std::string& path ) const
+Result<std::optional<schema::Schema>> Datastore::get_schema( std::string_view path ) const
 {
-    auto prop_result = get_property( path );
+    auto guard = lock();
+    auto prop_result = find_property( path );
     if ( !prop_result ) {
         return prop_result.error();
     }
@@ -115,7 +1120,7 @@ Result<std::optional<schema::Schema>> Datastore::get_schema( const std::string&
     const auto& schema = prop_result.value()->get_schema();
     if( !schema ) {
         return outcome::fail( error::Error_Code::SCHEMA_NOT_FOUND,
-                              "No schema found for path: " + path );
+                              "No schema found for path: " + std::string( path ) );
     }
 
     return outcome::ok<std::optional<schema::Schema>>( schema );
@@ -124,8 +1129,9 @@ Result<std::optional<schema::Schema>> Datastore::get_schema( const std::string&
 /********************************/
 /*         Validate Property    */
 /********************************/
-Result<void> Datastore::validate_property(const std::string& path) const {
-    auto prop_result = get_property(path);
+Result<void> Datastore::validate_property( std::string_view path ) const {
+    auto guard = lock();
+    auto prop_result = find_property(path);
     if (!prop_result) {
         return prop_result.error();
     }
@@ -137,6 +1143,7 @@ Result<void> Datastore::validate_property(const std::string& path) const {
 /*         Validate All         */
 /********************************/
 Result<void> Datastore::validate_all() const {
+    auto guard = lock();
     return m_root->validate();
 }
 
@@ -178,43 +1185,45 @@ Result<void> Datastore::parse_command_line_args(const std::vector<std::string>&
 /****************************************/
 /*         List Properties              */
 /****************************************/
-Result<std::vector<std::string>> Datastore::list_properties(const std::string& base_path) const {
+Result<std::vector<std::string>> Datastore::list_properties( std::string_view base_path ) const {
+    auto guard = lock();
     std::vector<std::string> properties;
 
     if (base_path.empty()) {
         // List root-level properties
-        auto children = m_root->get_child_keys();
-        for (const auto& child : children) {
-            properties.push_back(child);
-        }
+        properties.reserve( m_root->child_count() );
+        m_root->for_each_child( [&]( const std::string& key, const auto& ) {
+            properties.push_back( key );
+        });
     } else {
         // List properties under the specified path
-        auto base_result = get_property(base_path);
+        auto base_result = find_property(base_path);
         if (!base_result) {
             return base_result.error();
         }
 
-        auto base_obj = std::dynamic_pointer_cast<prop::Object_Property>(base_result.value());
-        if (!base_obj) {
+        if( base_result.value()->get_type() != schema::Property_Value_Type::OBJECT ) {
             return outcome::fail( error::Error_Code::NOT_FOUND,
-                                     "Path is not an object: " + base_path);
+                                     "Path is not an object: " + std::string( base_path ) );
         }
 
-        auto children = base_obj->get_child_keys();
-        for (const auto& child : children) {
-            properties.push_back(base_path + "." + child);
-        }
+        const auto& base_obj = static_cast<const prop::Object_Property&>( *base_result.value() );
+        properties.reserve( base_obj.child_count() );
+        base_obj.for_each_child( [&]( const std::string& key, const auto& ) {
+            properties.push_back( std::string( base_path ) + "." + key );
+        });
     }
 
-    std::sort(properties.begin(), properties.end());
+    // Children are stored in atom order
+    std::sort( properties.begin(), properties.end() );
     return outcome::ok<std::vector<std::string>>(properties);
 }
 
 /****************************************/
 /*         Has Property                 */
 /****************************************/
-Result<bool> Datastore::has_property(const std::string& path) const {
-    auto result = get_property(path);
+Result<bool> Datastore::has_property( std::string_view path ) const {
+    auto result = find_property(path);
     return outcome::ok<bool>(result.has_value());
 }
 
@@ -222,39 +1231,74 @@ Result<bool> Datastore::has_property(const std::string& path) const {
 /*         Clear                        */
 /****************************************/
 void Datastore::clear() {
-    m_root = std::make_shared<prop::Object_Property>("root");
+    Write_Scope scope( *this );
+    m_write.cursor.reset();
+
+    // Drop the index first so the old arena can be released as soon as the tree goes
+    m_index.clear();
+    m_root.reset();
+    m_arena = std::make_shared<prop::Property_Arena>();
+    m_root  = make_property<prop::Object_Property>("root");
+    commit_index();
+    scope.finish( outcome::ok() );
+    refresh_live_subtree( "" );
+}
+
+/****************************************/
+/*         Get Root                     */
+/****************************************/
+std::shared_ptr<prop::Object_Property> Datastore::get_root() const {
+    auto guard = lock();
+    return m_root;
+}
+
+/****************************************/
+/*         Set Root                     */
+/****************************************/
+void Datastore::set_root( std::shared_ptr<prop::Object_Property> root ) {
+    Write_Scope scope( *this );
+    m_write.cursor.reset();
+    m_root = std::move( root );
+    sync_index();
+    scope.finish( outcome::ok() );
+    refresh_live_subtree( "" );
+}
+
+/****************************************/
+/*         Arena Stats                  */
+/****************************************/
+prop::Property_Arena::Stats Datastore::arena_stats() const {
+    auto guard = lock();
+    return m_arena->stats();
 }
 
 /****************************************/
 /*         Size                         */
 /****************************************/
 size_t Datastore::size() const {
-    // Count all properties recursively
-    std::function<size_t(std::shared_ptr<prop::Property>)> count_recursive =
-        [&](std::shared_ptr<prop::Property> prop) -> size_t {
-            size_t count = 1;
-            if (prop->get_type() == schema::Property_Value_Type::OBJECT) {
-                auto obj = std::dynamic_pointer_cast<prop::Object_Property>(prop);
-                auto children = obj->get_child_keys();
-                for (const auto& child_key : children) {
-                    auto child_prop = obj->get_property(child_key);
-                    if (child_prop) {
-                        count += count_recursive(child_prop.value());
-                    }
-                }
-            } else if (prop->get_type() == schema::Property_Value_Type::ARRAY) {
-                auto arr = std::dynamic_pointer_cast<prop::Array_Property>(prop);
-                for (size_t i = 0; i < arr->size(); ++i) {
-                    auto item = arr->get_item(i);
-                    if (item) {
-                        count += count_recursive(item.value());
-                    }
-                }
-            }
-            return count;
-        };
+    auto guard = lock();
+    return m_root->get_subtree_stats().node_count - 1; // Subtract 1 for root
+}
+
+/****************************************/
+/*         Stats                        */
+/****************************************/
+prop::Subtree_Stats Datastore::stats() const {
+    auto guard = lock();
+
+    // Report the stored properties; the root itself is not counted
+    auto stats = m_root->get_subtree_stats();
+    stats.node_count -= 1;
+    stats.type_counts[static_cast<size_t>( schema::Property_Value_Type::OBJECT )] -= 1;
+    return stats;
+}
 
-    return count_recursive(m_root) - 1; // Subtract 1 for root
+/****************************************/
+/*         Content Hash                 */
+/****************************************/
+uint64_t Datastore::content_hash() const {
+    auto guard = lock();
+    return m_root->get_content_hash();
 }
 
 /****************************************/
@@ -293,7 +1337,7 @@ std::shared_ptr<prop::Property> Datastore::infer_property_from_string(const std:
 
     // Boolean values
     if (value == "true" || value == "false") {
-        auto prop = std::make_shared<prop::Boolean_Property>(key);
+        auto prop = make_property<prop::Boolean_Property>(key);
         prop->set_typed_value(value == "true");
         return prop;
     }
@@ -304,7 +1348,7 @@ std::shared_ptr<prop::Property> Datastore::infer_property_from_string(const std:
     })) {
         try {
             int64_t int_val = std::stoll(value);
-            auto prop = std::make_shared<prop::Integer_Property>(key);
+            auto prop = make_property<prop::Integer_Property>(key);
             prop->set_typed_value(int_val);
             return prop;
         } catch (...) {
@@ -318,7 +1362,7 @@ std::shared_ptr<prop::Property> Datastore::infer_property_from_string(const std:
     })) {
         try {
             double float_val = std::stod(value);
-            auto prop = std::make_shared<prop::Float_Property>(key);
+            auto prop = make_property<prop::Float_Property>(key);
             prop->set_typed_value(static_cast<float>(float_val));
             return prop;
         } catch (...) {
@@ -327,27 +1371,73 @@ std::shared_ptr<prop::Property> Datastore::infer_property_from_string(const std:
     }
 
     // Default to string
-    auto prop = std::make_shared<prop::String_Property>(key);
+    auto prop = make_property<prop::String_Property>(key);
     prop->set_typed_value(value);
     return prop;
 }
 
 /********************************/
-/*         Split Path           */
+/*         Sync Index           */
 /********************************/
-std::vector<std::string> Datastore::split_path( const std::string& path ) const
+void Datastore::sync_index()
 {
-    std::vector<std::string> parts;
-    std::stringstream ss(path);
-    std::string part;
+    if( index_current() ) {
+        return;
+    }
+    m_index.clear();
+    std::string path;
+    m_root->for_each_child( [&]( const std::string& key, const std::shared_ptr<prop::Property>& child ) {
+        path = key;
+        index_subtree( path, child );
+    });
+    commit_index();
+}
 
-    while (std::getline(ss, part, '.')) {
-        if (!part.empty()) {
-            parts.push_back(part);
-        }
+/********************************/
+/*         Commit Index         */
+/********************************/
+void Datastore::commit_index()
+{
+    m_index_generation = m_root->get_structure_generation();
+}
+
+/********************************/
+/*         Index Subtree        */
+/********************************/
+void Datastore::index_subtree( std::string&                           path,
+                               const std::shared_ptr<prop::Property>& property )
+{
+    m_index.insert( path, property );
+    if( property->get_type() != schema::Property_Value_Type::OBJECT ) {
+        return;
+    }
+
+    const auto& object = static_cast<const prop::Object_Property&>( *property );
+    const auto  length = path.size();
+    object.for_each_child( [&]( const std::string& key, const std::shared_ptr<prop::Property>& child ) {
+        path.append( "." ).append( key );
+        index_subtree( path, child );
+        path.resize( length );
+    });
+}
+
+/********************************/
+/*        Unindex Subtree       */
+/********************************/
+void Datastore::unindex_subtree( std::string& path, const prop::Property& property )
+{
+    m_index.erase( path );
+    if( property.get_type() != schema::Property_Value_Type::OBJECT ) {
+        return;
     }
 
-    return parts;
+    const auto& object = static_cast<const prop::Object_Property&>( property );
+    const auto  length = path.size();
+    object.for_each_child( [&]( const std::string& key, const std::shared_ptr<prop::Property>& child ) {
+        path.append( "." ).append( key );
+        unindex_subtree( path, *child );
+        path.resize( length );
+    });
 }
 
 } // namespace tmns::fcs
@@ -0,0 +1,176 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    diff.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/diff.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <memory>
+
+// Project Libraries
+#include <terminus/fcs/prop/object_property.hpp>
+
+namespace tmns::fcs {
+
+/**
+ * Get a property as an object, or nullptr if it is missing or not an object
+ */
+static const prop::Object_Property* as_object( const prop::Property* property )
+{
+    return property != nullptr && property->get_type() == schema::Property_Value_Type::OBJECT
+         ? static_cast<const prop::Object_Property*>( property ) : nullptr;
+}
+
+/**
+ * Compare two objects' children, recursing into objects present on both sides
+ */
+static void diff_children( const prop::Object_Property& before,
+                           const prop::Object_Property& after,
+                           std::string&                 path,
+                           const Change_Visitor&        visit )
+{
+    // Children are sorted by atom, so both lists are merged in one pass
+    const size_t before_count = before.child_count();
+    const size_t after_count  = after.child_count();
+    size_t i = 0;
+    size_t j = 0;
+    while( i < before_count || j < after_count ) {
+        const prop::Property* before_child = nullptr;
+        const prop::Property* after_child  = nullptr;
+        prop::Key_Atom atom{ 0 };
+        if( j == after_count || ( i < before_count && before.child_atom( i ) < after.child_atom( j ) ) ) {
+            atom = before.child_atom( i );
+            before_child = before.child_at( i++ ).get();
+        }
+        else if( i == before_count || after.child_atom( j ) < before.child_atom( i ) ) {
+            atom = after.child_atom( j );
+            after_child = after.child_at( j++ ).get();
+        }
+        else {
+            atom = before.child_atom( i );
+            before_child = before.child_at( i++ ).get();
+            after_child  = after.child_at( j++ ).get();
+        }
+
+        // Shared or identical subtrees need no visit
+        if( before_child == after_child ||
+            ( before_child != nullptr && after_child != nullptr &&
+              before_child->get_type() == after_child->get_type() &&
+              before_child->get_content_hash() == after_child->get_content_hash() ) )
+        {
+            continue;
+        }
+
+        const auto length = path.size();
+        path.append( path.empty() ? "" : "." ).append( prop::Key_Pool::instance().str( atom ) );
+        if( before_child == nullptr ) {
+            visit( Change_Kind::ADDED, path, nullptr, after_child );
+        }
+        else if( after_child == nullptr ) {
+            visit( Change_Kind::REMOVED, path, before_child, nullptr );
+        }
+        else if( auto before_object = as_object( before_child ), after_object = as_object( after_child );
+                 before_object != nullptr && after_object != nullptr )
+        {
+            diff_children( *before_object, *after_object, path, visit );
+        }
+        else {
+            visit( Change_Kind::MODIFIED, path, before_child, after_child );
+        }
+        path.resize( length );
+    }
+}
+
+/**
+ * Get the scalar value of a property, or nothing for containers and missing properties
+ */
+static std::optional<Value> scalar_value( const prop::Property* property )
+{
+    if( property == nullptr ) {
+        return std::nullopt;
+    }
+    auto value = property->get_scalar_value();
+    return value ? std::optional<Value>( std::move( value.value() ) ) : std::nullopt;
+}
+
+/********************************/
+/*          Diff Trees          */
+/********************************/
+void diff_trees( const prop::Property& before, const prop::Property& after, const Change_Visitor& visit )
+{
+    if( &before == &after ||
+        ( before.get_type() == after.get_type() && before.get_content_hash() == after.get_content_hash() ) )
+    {
+        return;
+    }
+
+    auto before_object = as_object( &before );
+    auto after_object  = as_object( &after );
+    if( before_object == nullptr || after_object == nullptr ) {
+        visit( Change_Kind::MODIFIED, {}, &before, &after );
+        return;
+    }
+    std::string path;
+    diff_children( *before_object, *after_object, path, visit );
+}
+
+/********************************/
+/*             Diff             */
+/********************************/
+std::vector<Property_Change> diff( const prop::Property& before, const prop::Property& after )
+{
+    std::vector<Property_Change> changes;
+    diff_trees( before, after, [&]( Change_Kind           kind,
+                                    std::string_view      path,
+                                    const prop::Property* old_property,
+                                    const prop::Property* new_property ) {
+        changes.push_back( Property_Change{ kind,
+                                            std::string( path ),
+                                            scalar_value( old_property ),
+                                            scalar_value( new_property ) } );
+    });
+
+    // Children are merged in atom order; report them in path order
+    std::sort( changes.begin(), changes.end(), []( const auto& lhs, const auto& rhs ) {
+        return lhs.path < rhs.path;
+    });
+    return changes;
+}
+
+/********************************/
+/*        Diff Snapshots        */
+/********************************/
+std::vector<Property_Change> diff( const Snapshot& before, const Snapshot& after )
+{
+    return diff( *before.get_root(), *after.get_root() );
+}
+
+/********************************/
+/*       Diff Datastores        */
+/********************************/
+std::vector<Property_Change> diff( const Datastore& before, const Datastore& after )
+{
+    // Published trees are immutable; hold them so writers can carry on
+    auto stable_root = []( const Datastore& datastore ) -> std::shared_ptr<const prop::Object_Property> {
+        if( auto snapshot = datastore.snapshot() ) {
+            return snapshot->get_root();
+        }
+        return datastore.get_root();
+    };
+    auto before_root = stable_root( before );
+    auto after_root  = stable_root( after );
+    return diff( *before_root, *after_root );
+}
+
+} // End of tmns::fcs namespace
@@ -0,0 +1,150 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    epoch_manager.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/epoch_manager.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <limits>
+
+namespace tmns::fcs {
+
+/*****************************/
+/*         Instance          */
+/*****************************/
+Epoch_Manager& Epoch_Manager::instance()
+{
+    // Never destroyed, so records stay valid while threads exit
+    static Epoch_Manager* s_manager = new Epoch_Manager();
+    return *s_manager;
+}
+
+/*****************************/
+/*            Pin            */
+/*****************************/
+Epoch_Manager::Guard Epoch_Manager::pin()
+{
+    Reader_Record* record = local_record();
+    if( record->depth++ == 0 ) {
+        // Must be visible before the reader loads any shared pointer
+        record->epoch.store( m_epoch.load( std::memory_order_relaxed ), std::memory_order_seq_cst );
+    }
+    return Guard( record );
+}
+
+/*****************************/
+/*          Retire           */
+/*****************************/
+void Epoch_Manager::retire( std::shared_ptr<const void> object )
+{
+    if( !object ) {
+        return;
+    }
+
+    // Readers that pin after this point can no longer reach the object
+    const auto epoch = m_epoch.fetch_add( 1, std::memory_order_seq_cst );
+
+    std::lock_guard<std::mutex> lock( m_retired_mutex );
+    m_retired.push_back( Retired{ std::move( object ), epoch } );
+}
+
+/*****************************/
+/*          Reclaim          */
+/*****************************/
+size_t Epoch_Manager::reclaim()
+{
+    std::vector<Retired> released;
+    {
+        std::lock_guard<std::mutex> lock( m_retired_mutex );
+        const auto oldest = oldest_pinned_epoch();
+        auto keep = std::partition( m_retired.begin(), m_retired.end(), [&]( const Retired& retired ) {
+            return retired.epoch >= oldest;
+        });
+        released.assign( std::make_move_iterator( keep ), std::make_move_iterator( m_retired.end() ) );
+        m_retired.erase( keep, m_retired.end() );
+    }
+
+    // Objects are destroyed here, outside the lock
+    return released.size();
+}
+
+/*****************************/
+/*          Pending          */
+/*****************************/
+size_t Epoch_Manager::pending() const
+{
+    std::lock_guard<std::mutex> lock( m_retired_mutex );
+    return m_retired.size();
+}
+
+/*****************************/
+/*       Local Record        */
+/*****************************/
+Epoch_Manager::Reader_Record* Epoch_Manager::local_record()
+{
+    struct Thread_Slot
+    {
+        Reader_Record* record{ nullptr };
+
+        ~Thread_Slot()
+        {
+            if( record != nullptr ) {
+                record->epoch.store( 0, std::memory_order_release );
+                record->depth = 0;
+                record->claimed.store( false, std::memory_order_release );
+            }
+        }
+    };
+    thread_local Thread_Slot t_slot;
+    if( t_slot.record != nullptr ) {
+        return t_slot.record;
+    }
+
+    // Reuse a record released by an exited thread
+    for( auto record = m_records.load( std::memory_order_acquire ); record != nullptr; record = record->next ) {
+        bool expected = false;
+        if( !record->claimed.load( std::memory_order_relaxed ) &&
+            record->claimed.compare_exchange_strong( expected, true, std::memory_order_acquire ) )
+        {
+            t_slot.record = record;
+            return record;
+        }
+    }
+
+    auto record = new Reader_Record();
+    record->claimed.store( true, std::memory_order_relaxed );
+    record->next = m_records.load( std::memory_order_relaxed );
+    while( !m_records.compare_exchange_weak( record->next, record,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed ) ) {}
+    t_slot.record = record;
+    return record;
+}
+
+/*****************************/
+/*    Oldest Pinned Epoch    */
+/*****************************/
+uint64_t Epoch_Manager::oldest_pinned_epoch() const
+{
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+    for( auto record = m_records.load( std::memory_order_acquire ); record != nullptr; record = record->next ) {
+        const auto epoch = record->epoch.load( std::memory_order_seq_cst );
+        if( epoch != 0 ) {
+            oldest = std::min( oldest, epoch );
+        }
+    }
+    return oldest;
+}
+
+} // End of tmns::fcs namespace
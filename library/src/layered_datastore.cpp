@@ -0,0 +1,225 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    layered_datastore.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/layered_datastore.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+
+namespace tmns::fcs {
+
+/********************************/
+/*          Push Layer          */
+/********************************/
+Result<void> Layered_Datastore::push_layer( std::string name, std::shared_ptr<const Snapshot> layer )
+{
+    if( !layer ) {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Cannot push null layer '" + name + "'" );
+    }
+    std::lock_guard<std::mutex> guard( m_mutex );
+    if( find_layer( name ) != m_layers.end() ) {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Layer already exists: " + name );
+    }
+    m_layers.push_back( Layer{ std::move( name ), std::move( layer ) } );
+    invalidate();
+    return outcome::ok();
+}
+
+/********************************/
+/*          Push Layer          */
+/********************************/
+Result<void> Layered_Datastore::push_layer( std::string name, Datastore layer )
+{
+    auto snapshot = layer.snapshot();
+    if( !snapshot ) {
+        snapshot = std::make_shared<const Snapshot>( layer.get_root(), layer.version() );
+    }
+    return push_layer( std::move( name ), std::move( snapshot ) );
+}
+
+/********************************/
+/*           Pop Layer          */
+/********************************/
+Result<void> Layered_Datastore::pop_layer()
+{
+    std::lock_guard<std::mutex> guard( m_mutex );
+    if( m_layers.empty() ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "No layers to pop" );
+    }
+    m_layers.pop_back();
+    invalidate();
+    return outcome::ok();
+}
+
+/********************************/
+/*         Remove Layer         */
+/********************************/
+Result<void> Layered_Datastore::remove_layer( std::string_view name )
+{
+    std::lock_guard<std::mutex> guard( m_mutex );
+    auto layer = find_layer( name );
+    if( layer == m_layers.end() ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Layer not found: " + std::string( name ) );
+    }
+    m_layers.erase( layer );
+    invalidate();
+    return outcome::ok();
+}
+
+/********************************/
+/*         Replace Layer        */
+/********************************/
+Result<void> Layered_Datastore::replace_layer( std::string_view name, std::shared_ptr<const Snapshot> layer )
+{
+    if( !layer ) {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Cannot replace layer '" + std::string( name ) + "' with null" );
+    }
+    std::lock_guard<std::mutex> guard( m_mutex );
+    auto found = find_layer( name );
+    if( found == m_layers.end() ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Layer not found: " + std::string( name ) );
+    }
+    found->snapshot = std::move( layer );
+    invalidate();
+    return outcome::ok();
+}
+
+/********************************/
+/*           Get Layer          */
+/********************************/
+Result<std::shared_ptr<const Snapshot>> Layered_Datastore::get_layer( std::string_view name ) const
+{
+    std::lock_guard<std::mutex> guard( m_mutex );
+    auto found = std::find_if( m_layers.begin(), m_layers.end(), [&]( const auto& layer ) {
+        return layer.name == name;
+    });
+    if( found == m_layers.end() ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Layer not found: " + std::string( name ) );
+    }
+    return outcome::ok<std::shared_ptr<const Snapshot>>( found->snapshot );
+}
+
+/********************************/
+/*          Layer Names         */
+/********************************/
+std::vector<std::string> Layered_Datastore::layer_names() const
+{
+    std::lock_guard<std::mutex> guard( m_mutex );
+    std::vector<std::string> names;
+    names.reserve( m_layers.size() );
+    for( const auto& layer : m_layers ) {
+        names.push_back( layer.name );
+    }
+    return names;
+}
+
+/********************************/
+/*          Layer Count         */
+/********************************/
+size_t Layered_Datastore::layer_count() const
+{
+    std::lock_guard<std::mutex> guard( m_mutex );
+    return m_layers.size();
+}
+
+/********************************/
+/*       Get Scalar Value       */
+/********************************/
+Result<Value> Layered_Datastore::get_scalar_value( std::string_view path ) const
+{
+    std::lock_guard<std::mutex> guard( m_mutex );
+    auto property = resolve( path ).property;
+    if( property == nullptr ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Property not found: " + std::string( path ) );
+    }
+    return property->get_scalar_value();
+}
+
+/********************************/
+/*         Has Property         */
+/********************************/
+bool Layered_Datastore::has_property( std::string_view path ) const
+{
+    std::lock_guard<std::mutex> guard( m_mutex );
+    return resolve( path ).property != nullptr;
+}
+
+/********************************/
+/*          Get Source          */
+/********************************/
+Result<std::string> Layered_Datastore::get_source( std::string_view path ) const
+{
+    std::lock_guard<std::mutex> guard( m_mutex );
+    const auto& resolution = resolve( path );
+    if( resolution.property == nullptr ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Property not found: " + std::string( path ) );
+    }
+    return outcome::ok<std::string>( m_layers[resolution.layer].name );
+}
+
+/********************************/
+/*            Resolve           */
+/********************************/
+const Layered_Datastore::Resolution& Layered_Datastore::resolve( std::string_view path ) const
+{
+    auto entry = m_cache.find( path );
+    if( entry == m_cache.end() ) {
+        entry = m_cache.emplace( std::string( path ), Resolution{} ).first;
+    }
+    auto& resolution = entry->second;
+    if( resolution.generation == m_generation ) {
+        return resolution;
+    }
+
+    // Probe top-down; misses are cached too
+    resolution = Resolution{ m_generation, nullptr, 0 };
+    for( size_t index = m_layers.size(); index-- > 0; ) {
+        if( auto property = m_layers[index].snapshot->view( path ).get() ) {
+            resolution.property = property;
+            resolution.layer    = index;
+            break;
+        }
+    }
+    return resolution;
+}
+
+/********************************/
+/*          Find Layer          */
+/********************************/
+std::vector<Layered_Datastore::Layer>::iterator Layered_Datastore::find_layer( std::string_view name )
+{
+    return std::find_if( m_layers.begin(), m_layers.end(), [&]( const auto& layer ) {
+        return layer.name == name;
+    });
+}
+
+/********************************/
+/*          Invalidate          */
+/********************************/
+void Layered_Datastore::invalidate()
+{
+    // Entries keep their strings and are re-probed on their next read
+    ++m_generation;
+}
+
+} // End of tmns::fcs namespace
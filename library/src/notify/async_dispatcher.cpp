@@ -0,0 +1,166 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    async_dispatcher.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/notify/async_dispatcher.hpp>
+
+// C++ Standard Libraries
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace tmns::fcs::notify {
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Async_Dispatcher::Async_Dispatcher( const Listener_Registry& registry, size_t capacity )
+  : m_registry( registry ),
+    m_queue( capacity ),
+    m_thread( [this]() { run(); } )
+{}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Async_Dispatcher::~Async_Dispatcher()
+{
+    m_stop.store( true, std::memory_order_release );
+    m_signal.fetch_add( 1, std::memory_order_release );
+    m_signal.notify_one();
+    m_thread.join();
+}
+
+/********************************/
+/*             Post             */
+/********************************/
+bool Async_Dispatcher::post( std::string path, std::shared_ptr<const prop::Property> property )
+{
+    Event event{ std::move( path ), std::move( property ), m_sequence.fetch_add( 1, std::memory_order_relaxed ) };
+    const bool queued = m_queue.try_push( event );
+    if( !queued ) {
+        // Never block the writer or lose a path's latest value; a later event replaces an earlier one
+        std::lock_guard<std::mutex> lock( m_overflow_mutex );
+        auto& slot = m_overflow[event.path];
+        if( slot.sequence <= event.sequence ) {
+            slot = std::move( event );
+        }
+        m_overflow_pending.fetch_add( 1, std::memory_order_release );
+        m_overflowed.fetch_add( 1, std::memory_order_relaxed );
+    }
+    m_posted.fetch_add( 1, std::memory_order_release );
+    m_signal.fetch_add( 1, std::memory_order_release );
+    m_signal.notify_one();
+    return queued;
+}
+
+/********************************/
+/*             Flush            */
+/********************************/
+void Async_Dispatcher::flush()
+{
+    const auto target = m_posted.load( std::memory_order_acquire );
+    auto consumed = m_consumed.load( std::memory_order_acquire );
+    while( consumed < target ) {
+        m_consumed.wait( consumed, std::memory_order_acquire );
+        consumed = m_consumed.load( std::memory_order_acquire );
+    }
+}
+
+/********************************/
+/*             Stats            */
+/********************************/
+Dispatch_Stats Async_Dispatcher::stats() const
+{
+    Dispatch_Stats stats;
+    stats.queue_depth = m_queue.size();
+    stats.posted      = m_posted.load( std::memory_order_relaxed );
+    stats.delivered   = m_delivered.load( std::memory_order_relaxed );
+    stats.coalesced   = m_coalesced.load( std::memory_order_relaxed );
+    stats.overflowed  = m_overflowed.load( std::memory_order_relaxed );
+    return stats;
+}
+
+/********************************/
+/*              Run             */
+/********************************/
+void Async_Dispatcher::run()
+{
+    std::vector<Event> batch;
+    batch.reserve( m_queue.capacity() );
+    for( ;; ) {
+        // Read the signal first so a post that lands after the drain wakes us
+        const auto signal = m_signal.load( std::memory_order_acquire );
+
+        Event event;
+        while( batch.size() < m_queue.capacity() && m_queue.try_pop( event ) ) {
+            batch.push_back( std::move( event ) );
+        }
+        const auto queued = batch.size();
+        const auto overflowed = take_overflow( batch );
+        if( !batch.empty() ) {
+            deliver( batch, queued + overflowed );
+            continue;
+        }
+        if( m_stop.load( std::memory_order_acquire ) ) {
+            return;
+        }
+        m_signal.wait( signal, std::memory_order_acquire );
+    }
+}
+
+/********************************/
+/*         Take Overflow        */
+/********************************/
+size_t Async_Dispatcher::take_overflow( std::vector<Event>& batch )
+{
+    if( m_overflow_pending.load( std::memory_order_acquire ) == 0 ) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock( m_overflow_mutex );
+    for( auto& [path, event] : m_overflow ) {
+        batch.push_back( std::move( event ) );
+    }
+    m_overflow.clear();
+    return m_overflow_pending.exchange( 0, std::memory_order_acq_rel );
+}
+
+/********************************/
+/*            Deliver           */
+/********************************/
+void Async_Dispatcher::deliver( std::vector<Event>& batch, size_t events )
+{
+    // Later events for a path supersede earlier ones, wherever they were held
+    std::unordered_map<std::string_view, size_t> latest;
+    latest.reserve( batch.size() );
+    for( size_t i = 0; i < batch.size(); ++i ) {
+        auto [entry, inserted] = latest.try_emplace( batch[i].path, i );
+        if( !inserted && batch[entry->second].sequence < batch[i].sequence ) {
+            entry->second = i;
+        }
+    }
+
+    for( size_t i = 0; i < batch.size(); ++i ) {
+        if( latest[batch[i].path] == i ) {
+            m_registry.dispatch( batch[i].path, batch[i].property.get() );
+        }
+    }
+    m_delivered.fetch_add( latest.size(), std::memory_order_relaxed );
+    m_coalesced.fetch_add( events - latest.size(), std::memory_order_relaxed );
+
+    batch.clear();
+    m_consumed.fetch_add( events, std::memory_order_release );
+    m_consumed.notify_all();
+}
+
+} // End of tmns::fcs::notify namespace
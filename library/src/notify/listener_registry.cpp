@@ -0,0 +1,250 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    listener_registry.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/notify/listener_registry.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+
+// Project Libraries
+#include <terminus/fcs/prop/object_property.hpp>
+#include <terminus/fcs/prop/path_segments.hpp>
+
+namespace tmns::fcs::notify {
+
+/********************************/
+/*              Add             */
+/********************************/
+Result<Listener_Id> Listener_Registry::add( std::string_view pattern, Change_Callback callback )
+{
+    Location location;
+    bool     wildcard = false;
+    for( auto segment : prop::Path_Segments( pattern ) ) {
+        if( wildcard ) {
+            return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                  "Wildcards must end a listener pattern: " + std::string( pattern ) );
+        }
+        if( segment == "**" ) {
+            if( !location.atoms.empty() ) {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Use 'prefix.*' to match below a prefix: " + std::string( pattern ) );
+            }
+            wildcard = true;
+        }
+        else if( segment == "*" ) {
+            if( location.atoms.empty() ) {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Use '**' to match every path: " + std::string( pattern ) );
+            }
+            wildcard = true;
+        }
+        else if( segment.find( '*' ) != std::string_view::npos ) {
+            return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                  "Wildcards must be a whole path component: " + std::string( pattern ) );
+        }
+        else {
+            auto atom = prop::Key_Pool::instance().intern( segment );
+            if( !atom ) {
+                return atom.error();
+            }
+            location.atoms.push_back( atom.value() );
+        }
+    }
+    if( location.atoms.empty() && !wildcard ) {
+        return outcome::fail( error::Error_Code::INVALID_INPUT, "Listener pattern is empty" );
+    }
+    location.below = wildcard;
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    Node* node = &m_root;
+    for( auto atom : location.atoms ) {
+        auto& child = node->children[atom];
+        if( !child ) {
+            child = std::make_unique<Node>();
+        }
+        node = child.get();
+    }
+
+    const auto id = m_next_id++;
+    auto& entries = location.below ? node->below : node->exact;
+    entries.push_back( Entry{ id, std::make_shared<const Change_Callback>( std::move( callback ) ) } );
+    m_locations.emplace( id, std::move( location ) );
+    m_size.fetch_add( 1, std::memory_order_release );
+    return outcome::ok<Listener_Id>( id );
+}
+
+/********************************/
+/*            Remove            */
+/********************************/
+bool Listener_Registry::remove( Listener_Id id )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    auto location = m_locations.find( id );
+    if( location == m_locations.end() ) {
+        return false;
+    }
+
+    Node* node = &m_root;
+    for( auto atom : location->second.atoms ) {
+        node = node->children.at( atom ).get();
+    }
+    auto& entries = location->second.below ? node->below : node->exact;
+    entries.erase( std::find_if( entries.begin(), entries.end(), [&]( const Entry& entry ) {
+        return entry.id == id;
+    }));
+
+    prune( m_root, location->second.atoms.data(), location->second.atoms.size() );
+    m_locations.erase( location );
+    m_size.fetch_sub( 1, std::memory_order_release );
+    return true;
+}
+
+/********************************/
+/*           Dispatch           */
+/********************************/
+size_t Listener_Registry::dispatch( std::string_view path, const prop::Property* property ) const
+{
+    if( empty() ) {
+        return 0;
+    }
+
+    // Everything below a removed or rewritten object changed too
+    std::vector<Delivery> deliveries;
+    if( property == nullptr || property->get_type() == schema::Property_Value_Type::OBJECT ) {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if( auto node = find_node( path ); node != nullptr && node != &m_root ) {
+            std::string below( path );
+            collect_below( *node, below, property, false, deliveries );
+        }
+    }
+
+    // Callbacks run unlocked so they may change the registry
+    auto callbacks = match( path );
+    for( const auto& callback : callbacks ) {
+        ( *callback )( path, property );
+    }
+    for( const auto& delivery : deliveries ) {
+        ( *delivery.callback )( delivery.path, delivery.property );
+    }
+    return callbacks.size() + deliveries.size();
+}
+
+/********************************/
+/*             Match            */
+/********************************/
+std::vector<std::shared_ptr<const Change_Callback>> Listener_Registry::match( std::string_view path ) const
+{
+    std::vector<std::shared_ptr<const Change_Callback>> result;
+
+    auto append = [&]( const std::vector<Entry>& entries ) {
+        for( const auto& entry : entries ) {
+            result.push_back( entry.callback );
+        }
+    };
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    const Node* node = &m_root;
+    for( auto segment : prop::Path_Segments( path ) ) {
+        // Every node passed on the way down is a prefix of the path
+        append( node->below );
+
+        // Keys never interned cannot have listeners
+        auto atom = prop::Key_Pool::instance().find( segment );
+        if( !atom ) {
+            return result;
+        }
+        auto child = node->children.find( *atom );
+        if( child == node->children.end() ) {
+            return result;
+        }
+        node = child->second.get();
+    }
+    if( node != &m_root ) {
+        append( node->exact );
+    }
+    return result;
+}
+
+/********************************/
+/*           Find Node          */
+/********************************/
+const Listener_Registry::Node* Listener_Registry::find_node( std::string_view path ) const
+{
+    const Node* node = &m_root;
+    for( auto segment : prop::Path_Segments( path ) ) {
+        auto atom = prop::Key_Pool::instance().find( segment );
+        if( !atom ) {
+            return nullptr;
+        }
+        auto child = node->children.find( *atom );
+        if( child == node->children.end() ) {
+            return nullptr;
+        }
+        node = child->second.get();
+    }
+    return node;
+}
+
+/********************************/
+/*         Collect Below        */
+/********************************/
+void Listener_Registry::collect_below( const Node&            node,
+                                       std::string&           path,
+                                       const prop::Property*  property,
+                                       bool                   own,
+                                       std::vector<Delivery>& deliveries )
+{
+    if( own ) {
+        for( const auto& entry : node.exact ) {
+            deliveries.push_back( Delivery{ path, property, entry.callback } );
+        }
+    }
+    for( const auto& entry : node.below ) {
+        deliveries.push_back( Delivery{ path, property, entry.callback } );
+    }
+
+    // Walk the property tree alongside the trie; only objects have keyed children
+    const auto object = property != nullptr && property->get_type() == schema::Property_Value_Type::OBJECT
+                      ? static_cast<const prop::Object_Property*>( property ) : nullptr;
+    const auto& pool = prop::Key_Pool::instance();
+    for( const auto& [atom, child] : node.children ) {
+        const prop::Property* child_property = nullptr;
+        if( object != nullptr ) {
+            if( auto found = object->get_property( pool.str( atom ) ) ) {
+                child_property = found.value().get();
+            }
+        }
+        const auto length = path.size();
+        path.append( "." ).append( pool.str( atom ) );
+        collect_below( *child, path, child_property, true, deliveries );
+        path.resize( length );
+    }
+}
+
+/********************************/
+/*             Prune            */
+/********************************/
+void Listener_Registry::prune( Node& node, const prop::Key_Atom* atoms, size_t count )
+{
+    if( count == 0 ) {
+        return;
+    }
+    auto child = node.children.find( atoms[0] );
+    prune( *child->second, atoms + 1, count - 1 );
+    if( child->second->empty() ) {
+        node.children.erase( child );
+    }
+}
+
+} // End of tmns::fcs::notify namespace
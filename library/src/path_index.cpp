@@ -0,0 +1,155 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    path_index.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/path_index.hpp>
+
+// C++ Standard Libraries
+#include <functional>
+#include <utility>
+
+namespace tmns::fcs {
+
+/// Initial slot count; must be a power of two
+constexpr size_t INITIAL_CAPACITY = 64;
+
+/********************************/
+/*            Find              */
+/********************************/
+const std::shared_ptr<prop::Property>* Path_Index::find( std::string_view path ) const
+{
+    if( m_size == 0 ) {
+        return nullptr;
+    }
+
+    const size_t mask = m_hashes.size() - 1;
+    const auto   hash = hash_path( path );
+    for( size_t slot = hash & mask; m_hashes[slot] != 0; slot = ( slot + 1 ) & mask ) {
+        if( m_hashes[slot] == hash && m_entries[slot].path == path ) {
+            return &m_entries[slot].property;
+        }
+    }
+    return nullptr;
+}
+
+/********************************/
+/*            Insert            */
+/********************************/
+void Path_Index::insert( std::string_view path, std::shared_ptr<prop::Property> property )
+{
+    // Keep the load factor at or below 1/2 so probe runs stay short
+    if( ( m_size + 1 ) * 2 > m_hashes.size() ) {
+        rehash( m_hashes.empty() ? INITIAL_CAPACITY : m_hashes.size() * 2 );
+    }
+
+    const size_t mask = m_hashes.size() - 1;
+    const auto   hash = hash_path( path );
+    size_t slot = hash & mask;
+    for( ; m_hashes[slot] != 0; slot = ( slot + 1 ) & mask ) {
+        if( m_hashes[slot] == hash && m_entries[slot].path == path ) {
+            m_entries[slot].property = std::move( property );
+            return;
+        }
+    }
+
+    m_hashes[slot]  = hash;
+    m_entries[slot] = Entry{ std::string( path ), std::move( property ) };
+    ++m_size;
+}
+
+/********************************/
+/*            Erase             */
+/********************************/
+bool Path_Index::erase( std::string_view path )
+{
+    if( m_size == 0 ) {
+        return false;
+    }
+
+    const size_t mask = m_hashes.size() - 1;
+    const auto   hash = hash_path( path );
+    size_t slot = hash & mask;
+    for( ; m_hashes[slot] != 0; slot = ( slot + 1 ) & mask ) {
+        if( m_hashes[slot] == hash && m_entries[slot].path == path ) {
+            break;
+        }
+    }
+    if( m_hashes[slot] == 0 ) {
+        return false;
+    }
+
+    // Shift later members of the probe run back into the hole
+    size_t hole = slot;
+    for( size_t next = ( hole + 1 ) & mask; m_hashes[next] != 0; next = ( next + 1 ) & mask ) {
+        const size_t home = m_hashes[next] & mask;
+        const bool   movable = ( hole <= next ) ? ( home <= hole || home > next )
+                                                : ( home <= hole && home > next );
+        if( movable ) {
+            m_hashes[hole]  = m_hashes[next];
+            m_entries[hole] = std::move( m_entries[next] );
+            hole = next;
+        }
+    }
+
+    m_hashes[hole]  = 0;
+    m_entries[hole] = Entry{};
+    --m_size;
+    return true;
+}
+
+/********************************/
+/*            Clear             */
+/********************************/
+void Path_Index::clear()
+{
+    m_hashes.clear();
+    m_entries.clear();
+    m_size = 0;
+}
+
+/********************************/
+/*          Hash Path           */
+/********************************/
+uint64_t Path_Index::hash_path( std::string_view path )
+{
+    const uint64_t hash = std::hash<std::string_view>{}( path );
+    return hash == 0 ? 1 : hash;
+}
+
+/********************************/
+/*            Rehash            */
+/********************************/
+void Path_Index::rehash( size_t capacity )
+{
+    auto old_hashes  = std::move( m_hashes );
+    auto old_entries = std::move( m_entries );
+
+    m_hashes.assign( capacity, 0 );
+    m_entries.clear();
+    m_entries.resize( capacity );
+
+    const size_t mask = capacity - 1;
+    for( size_t i = 0; i < old_hashes.size(); ++i ) {
+        if( old_hashes[i] == 0 ) {
+            continue;
+        }
+        size_t slot = old_hashes[i] & mask;
+        while( m_hashes[slot] != 0 ) {
+            slot = ( slot + 1 ) & mask;
+        }
+        m_hashes[slot]  = old_hashes[i];
+        m_entries[slot] = std::move( old_entries[i] );
+    }
+}
+
+} // End of tmns::fcs namespace
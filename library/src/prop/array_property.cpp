@@ -15,6 +15,7 @@
 #include <terminus/fcs/prop/array_property.hpp>
 
 // C++ Standard Libraries
+#include <algorithm>
 #include <stdexcept>
 
 // Terminus Libraries
@@ -26,7 +27,41 @@ namespace tmns::fcs::prop {
 /*****************************************/
 /*          Constructor                  */
 /*****************************************/
-Array_Property::Array_Property(const std::string& key) : Property(key) {}
+Array_Property::Array_Property()
+{
+    m_hash = content_hash::seed( schema::Property_Value_Type::ARRAY );
+}
+
+/*****************************************/
+/*          Constructor                  */
+/*****************************************/
+Array_Property::Array_Property(const std::string& key) : Property(key)
+{
+    m_hash = content_hash::seed( schema::Property_Value_Type::ARRAY );
+}
+
+/*****************************************/
+/*          Copy Constructor             */
+/*****************************************/
+Array_Property::Array_Property( const Array_Property& other )
+    : Property( other ),
+      m_items( other.m_items ),
+      m_stats( other.m_stats )
+{
+    // The copied item list may have a different capacity
+    m_stats.bytes = m_stats.bytes - other.approximate_bytes() + approximate_bytes();
+}
+
+/*****************************************/
+/*             Clone Node                */
+/*****************************************/
+std::shared_ptr<Property> Array_Property::clone_node( const std::shared_ptr<Property_Arena>& arena,
+                                                      uint64_t                               edit ) const
+{
+    auto copy = make_node<Array_Property>( arena, *this );
+    copy->m_edit = edit;
+    return copy;
+}
 
 /*****************************************/
 /*        Set the Property Value         */
@@ -75,7 +110,14 @@ Result<void> Array_Property::add_item(std::shared_ptr<Property> item) {
                                  "Cannot add null item to array" );
     }
 
+    const auto bytes_before = approximate_bytes();
+    attach_child( *item, m_items.size() );
     m_items.push_back(item);
+    stats_added( item->get_subtree_stats() );
+    adjust_bytes( static_cast<std::ptrdiff_t>( approximate_bytes() ) - static_cast<std::ptrdiff_t>( bytes_before ) );
+    update_hash( m_hash + content_hash::array_term( m_items.size() - 1, item->get_content_hash() ) );
+
+    mark_structure_changed();
     return outcome::ok();
 }
 
@@ -100,8 +142,65 @@ Result<void> Array_Property::remove_item( size_t index )
         return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
                                  "Array index out of bounds: " + std::to_string(index) );
     }
+    auto removed = std::move( m_items[index] );
+    detach_child( *removed );
     m_items.erase( m_items.begin() + static_cast<long>(index) );
+    for( size_t i = index; i < m_items.size(); ++i ) {
+        attach_child( *m_items[i], i );
+    }
+    stats_removed( removed->get_subtree_stats() );
+    update_hash( compute_hash() );
+
+    mark_structure_changed();
     return outcome::ok();
 }
 
+/*****************************************/
+/*        Approximate Bytes              */
+/*****************************************/
+size_t Array_Property::approximate_bytes() const
+{
+    return sizeof( Array_Property ) + m_items.capacity() * sizeof( std::shared_ptr<Property> );
+}
+
+/*****************************************/
+/*        Compute Height                 */
+/*****************************************/
+size_t Array_Property::compute_height() const
+{
+    size_t height = 0;
+    for( const auto& item : m_items ) {
+        height = std::max( height, item->get_subtree_stats().height + 1 );
+    }
+    return height;
+}
+
+/*****************************************/
+/*        Child Hash Term                */
+/*****************************************/
+uint64_t Array_Property::child_hash_term( const Property& child, uint64_t child_hash ) const
+{
+    // The attached position is checked, and only searched for if the item is shared and has moved
+    auto position = attached_position( child );
+    if( position >= m_items.size() || m_items[position].get() != &child ) {
+        auto found = std::find_if( m_items.begin(), m_items.end(), [&]( const auto& item ) {
+            return item.get() == &child;
+        });
+        position = static_cast<size_t>( found - m_items.begin() );
+    }
+    return content_hash::array_term( position, child_hash );
+}
+
+/*****************************************/
+/*        Compute Hash                   */
+/*****************************************/
+uint64_t Array_Property::compute_hash() const
+{
+    auto hash = content_hash::seed( schema::Property_Value_Type::ARRAY );
+    for( size_t i = 0; i < m_items.size(); ++i ) {
+        hash += content_hash::array_term( i, m_items[i]->get_content_hash() );
+    }
+    return hash;
+}
+
 } // namespace tmns::fcs::prop
\ No newline at end of file
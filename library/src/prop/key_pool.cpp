@@ -0,0 +1,152 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    key_pool.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/prop/key_pool.hpp>
+
+// C++ Standard Libraries
+#include <functional>
+
+namespace tmns::fcs::prop {
+
+/// Initial slot count of the lookup table; must be a power of two
+constexpr size_t INITIAL_TABLE_SIZE = 1024;
+
+/*****************************/
+/*        Instance           */
+/*****************************/
+Key_Pool& Key_Pool::instance()
+{
+    // Never destroyed, so keys stay valid during static destruction
+    static Key_Pool* s_pool = new Key_Pool();
+    return *s_pool;
+}
+
+/*****************************/
+/*        Constructor        */
+/*****************************/
+Key_Pool::Key_Pool()
+{
+    m_tables.push_back( build_table( INITIAL_TABLE_SIZE ) );
+    m_table.store( m_tables.back().get(), std::memory_order_release );
+    m_bytes.store( INITIAL_TABLE_SIZE * sizeof( uint32_t ), std::memory_order_relaxed );
+
+    // Atom zero is the empty key used by default-constructed properties
+    [[maybe_unused]] auto empty = intern( "" );
+}
+
+/*****************************/
+/*          Intern           */
+/*****************************/
+Result<Key_Atom> Key_Pool::intern( std::string_view key )
+{
+    if( auto atom = find( key ) ) {
+        return outcome::ok<Key_Atom>( *atom );
+    }
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if( auto atom = find( key ) ) {
+        return outcome::ok<Key_Atom>( *atom );
+    }
+
+    const size_t atom = m_size.load( std::memory_order_relaxed );
+    const size_t chunk = atom >> CHUNK_BITS;
+    if( chunk >= MAX_CHUNKS ) {
+        return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
+                              "Key pool is full; cannot intern key: " + std::string( key ) );
+    }
+    if( m_chunks[chunk].load( std::memory_order_relaxed ) == nullptr ) {
+        m_chunks[chunk].store( new Entry[CHUNK_SIZE], std::memory_order_release );
+        m_bytes.fetch_add( CHUNK_SIZE * sizeof( Entry ), std::memory_order_relaxed );
+    }
+
+    auto& slot_entry = m_chunks[chunk].load( std::memory_order_relaxed )[atom & ( CHUNK_SIZE - 1 )];
+    slot_entry.text = std::string( key );
+    slot_entry.hash = hash_key( key );
+    m_bytes.fetch_add( slot_entry.text.capacity(), std::memory_order_relaxed );
+    m_size.store( atom + 1, std::memory_order_release );
+
+    // Grow at half load, publishing a new table; readers may still be probing the old one
+    Table* table = m_table.load( std::memory_order_relaxed );
+    if( ( atom + 1 ) * 2 > table->mask + 1 ) {
+        m_tables.push_back( build_table( ( table->mask + 1 ) * 2 ) );
+        m_table.store( m_tables.back().get(), std::memory_order_release );
+        m_bytes.fetch_add( ( m_tables.back()->mask + 1 ) * sizeof( uint32_t ), std::memory_order_relaxed );
+        return outcome::ok<Key_Atom>( static_cast<Key_Atom>( atom ) );
+    }
+
+    size_t slot = slot_entry.hash & table->mask;
+    while( table->slots[slot].load( std::memory_order_relaxed ) != 0 ) {
+        slot = ( slot + 1 ) & table->mask;
+    }
+    table->slots[slot].store( static_cast<uint32_t>( atom + 1 ), std::memory_order_release );
+    return outcome::ok<Key_Atom>( static_cast<Key_Atom>( atom ) );
+}
+
+/*****************************/
+/*           Find            */
+/*****************************/
+std::optional<Key_Atom> Key_Pool::find( std::string_view key ) const
+{
+    const Table* table = m_table.load( std::memory_order_acquire );
+    const auto   hash  = hash_key( key );
+
+    for( size_t slot = hash & table->mask; ; slot = ( slot + 1 ) & table->mask ) {
+        const uint32_t value = table->slots[slot].load( std::memory_order_acquire );
+        if( value == 0 ) {
+            return std::nullopt;
+        }
+        const auto& candidate = entry( value - 1 );
+        if( candidate.hash == hash && candidate.text == key ) {
+            return value - 1;
+        }
+    }
+}
+
+/*****************************/
+/*           Bytes           */
+/*****************************/
+size_t Key_Pool::bytes() const
+{
+    return m_bytes.load( std::memory_order_relaxed );
+}
+
+/*****************************/
+/*         Hash Key          */
+/*****************************/
+uint64_t Key_Pool::hash_key( std::string_view key )
+{
+    return std::hash<std::string_view>{}( key );
+}
+
+/*****************************/
+/*        Build Table        */
+/*****************************/
+std::unique_ptr<Key_Pool::Table> Key_Pool::build_table( size_t capacity ) const
+{
+    auto table   = std::make_unique<Table>();
+    table->mask  = capacity - 1;
+    table->slots = std::make_unique<std::atomic<uint32_t>[]>( capacity );
+
+    const size_t count = m_size.load( std::memory_order_relaxed );
+    for( size_t atom = 0; atom < count; ++atom ) {
+        size_t slot = entry( static_cast<Key_Atom>( atom ) ).hash & table->mask;
+        while( table->slots[slot].load( std::memory_order_relaxed ) != 0 ) {
+            slot = ( slot + 1 ) & table->mask;
+        }
+        table->slots[slot].store( static_cast<uint32_t>( atom + 1 ), std::memory_order_relaxed );
+    }
+    return table;
+}
+
+} // End of tmns::fcs::prop namespace
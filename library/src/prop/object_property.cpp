@@ -14,13 +14,55 @@
 */
 #include <terminus/fcs/prop/object_property.hpp>
 
+// C++ Standard Libraries
+#include <algorithm>
+
 namespace tmns::fcs::prop {
 
+/// Objects up to this size are searched by a linear atom scan
+constexpr size_t LINEAR_SCAN_LIMIT = 16;
+
+/**********************************/
+/*          Constructor           */
+/**********************************/
+Object_Property::Object_Property()
+{
+    m_hash = content_hash::seed( schema::Property_Value_Type::OBJECT );
+}
+
 /**********************************/
 /*          Constructor           */
 /**********************************/
 Object_Property::Object_Property( const std::string& key )
-    : Property(key) {}
+    : Property(key)
+{
+    m_hash = content_hash::seed( schema::Property_Value_Type::OBJECT );
+}
+
+/**********************************/
+/*        Copy Constructor        */
+/**********************************/
+Object_Property::Object_Property( const Object_Property& other )
+    : Property( other ),
+      std::enable_shared_from_this<Object_Property>(),
+      m_child_atoms( other.m_child_atoms ),
+      m_children( other.m_children ),
+      m_stats( other.m_stats )
+{
+    // The copied child lists may have a different capacity
+    m_stats.bytes = m_stats.bytes - other.approximate_bytes() + approximate_bytes();
+}
+
+/**********************************/
+/*           Clone Node           */
+/**********************************/
+std::shared_ptr<Property> Object_Property::clone_node( const std::shared_ptr<Property_Arena>& arena,
+                                                       uint64_t                               edit ) const
+{
+    auto copy = make_node<Object_Property>( arena, *this );
+    copy->m_edit = edit;
+    return copy;
+}
 
 /**********************************/
 /*          Set Value             */
@@ -52,7 +94,7 @@ Result<void> Object_Property::validate() const
     }
 
     // Validate all children
-    for (const auto& [key, child] : m_children) {
+    for (const auto& child : m_children) {
         auto child_result = child->validate();
         if (!child_result) {
             return child_result;
@@ -72,120 +114,236 @@ Result<void> Object_Property::add_property( std::shared_ptr<Property> property )
                               "Cannot add null property" );
     }
 
-    m_children[property->get_key()] = property;
+    const auto bytes_before = approximate_bytes();
+    const auto atom = property->get_key_atom();
+    const auto pos  = lower_bound( atom );
+    auto hash = m_hash + child_hash_term( *property, property->get_content_hash() );
+    if( pos < m_child_atoms.size() && m_child_atoms[pos] == atom ) {
+        auto replaced = std::move( m_children[pos] );
+        detach_child( *replaced );
+        m_children[pos] = property;
+        stats_removed( replaced->get_subtree_stats() );
+        hash -= child_hash_term( *replaced, replaced->get_content_hash() );
+    }
+    else {
+        const auto offset = static_cast<std::ptrdiff_t>( pos );
+        m_child_atoms.insert( m_child_atoms.begin() + offset, atom );
+        m_children.insert( m_children.begin() + offset, property );
+    }
+    attach_child( *property );
+    stats_added( property->get_subtree_stats() );
+    adjust_bytes( static_cast<std::ptrdiff_t>( approximate_bytes() ) - static_cast<std::ptrdiff_t>( bytes_before ) );
+    update_hash( hash );
+
+    mark_structure_changed();
     return outcome::ok();
 }
 
 /**********************************/
-/*          Get Property          */
+/*          Find Child            */
 /**********************************/
-Result<std::shared_ptr<Property>> Object_Property::get_property(const std::string& key) const
+const std::shared_ptr<Property>* Object_Property::find_child( std::string_view key ) const
 {
-    auto it = m_children.find(key);
-    if (it == m_children.end()) {
-        return outcome::fail( error::Error_Code::NOT_FOUND,
-                              "Property not found: " + key );
+    // A key that was never interned cannot name a child
+    const auto atom = Key_Pool::instance().find( key );
+    if( !atom ) {
+        return nullptr;
     }
-    return outcome::ok<std::shared_ptr<Property>>( it->second );
+    return find_child( *atom );
 }
 
 /**********************************/
-/*          Remove Property       */
+/*       Find Child By Atom       */
 /**********************************/
-Result<void> Object_Property::remove_property(const std::string& key)
+const std::shared_ptr<Property>* Object_Property::find_child( Key_Atom atom ) const
 {
-    auto it = m_children.find(key);
-    if (it == m_children.end()) {
-        return outcome::fail( error::Error_Code::NOT_FOUND,
-                              "Child property not found: " + key );
+    if( m_children.size() <= LINEAR_SCAN_LIMIT ) {
+        for( size_t i = 0; i < m_child_atoms.size(); ++i ) {
+            if( m_child_atoms[i] == atom ) {
+                return &m_children[i];
+            }
+        }
+        return nullptr;
     }
-    m_children.erase(it);
-    return outcome::ok();
+
+    const auto pos = lower_bound( atom );
+    if( pos < m_child_atoms.size() && m_child_atoms[pos] == atom ) {
+        return &m_children[pos];
+    }
+    return nullptr;
 }
 
 /**********************************/
-/*          Resolve Path          */
+/*          Lower Bound           */
 /**********************************/
-Result<std::shared_ptr<Property>> Object_Property::resolve_path(const std::string& path) const
+size_t Object_Property::lower_bound( Key_Atom atom ) const
 {
-    auto path_parts = split_path(path);
-    if (path_parts.empty()) {
-        // Return a copy of shared_from_this() but as Property (non-const)
-        auto non_const_this = std::const_pointer_cast<Object_Property>(std::static_pointer_cast<const Object_Property>(shared_from_this()));
-        return outcome::ok<std::shared_ptr<Property>>( std::static_pointer_cast<Property>(non_const_this) );
-    }
+    auto it = std::lower_bound( m_child_atoms.begin(), m_child_atoms.end(), atom );
+    return static_cast<size_t>( it - m_child_atoms.begin() );
+}
+
+/**********************************/
+/*          Segment Name          */
+/**********************************/
+static std::string segment_name( std::string_view segment )
+{
+    return std::string( segment );
+}
+
+static std::string segment_name( Key_Atom segment )
+{
+    return Key_Pool::instance().str( segment );
+}
 
-    std::shared_ptr<Property> current = std::static_pointer_cast<Property>(std::const_pointer_cast<Object_Property>(std::static_pointer_cast<const Object_Property>(shared_from_this())));
+/**********************************/
+/*        Resolve Segments        */
+/**********************************/
+template <typename Segment_Range>
+Result<std::shared_ptr<Property>> Object_Property::resolve_segments( const Segment_Range& segments ) const
+{
+    const Object_Property* current = this;
+    const std::shared_ptr<Property>* found = nullptr;
 
-    for (const auto& part : path_parts) {
-        if (current->get_type() != schema::Property_Value_Type::OBJECT) {
+    for( const auto& part : segments ) {
+        if( current == nullptr ) {
             return outcome::fail( error::Error_Code::INVALID_INPUT,
-                                  "Path component '" + part + "' is not an object");
+                                  "Path component '" + segment_name( part ) + "' is not an object" );
         }
 
-        auto obj_prop = std::dynamic_pointer_cast<Object_Property>(current);
-        auto result = obj_prop->get_property(part);
-        if (!result) {
-            return result;
+        found = current->find_child( part );
+        if( found == nullptr ) {
+            return outcome::fail( error::Error_Code::NOT_FOUND,
+                                  "Property not found: " + segment_name( part ) );
         }
-        current = result.value();
+
+        // The type tag identifies objects, so no dynamic cast is needed
+        current = (*found)->get_type() == schema::Property_Value_Type::OBJECT
+                ? static_cast<const Object_Property*>( found->get() )
+                : nullptr;
     }
 
-    return outcome::ok<std::shared_ptr<Property>>(current);
+    if( found == nullptr ) {
+        // Empty path resolves to this object
+        auto non_const_this = std::const_pointer_cast<Object_Property>( shared_from_this() );
+        return outcome::ok<std::shared_ptr<Property>>( std::static_pointer_cast<Property>( non_const_this ) );
+    }
+    return outcome::ok<std::shared_ptr<Property>>( *found );
 }
 
 /**********************************/
-/*          Set Path Value        */
+/*           Find Path            */
 /**********************************/
-Result<void> Object_Property::set_path_value(const std::string& path, const std::any& value)
+const std::shared_ptr<Property>* Object_Property::find_path( std::string_view path ) const
 {
-    auto path_parts = split_path(path);
-    if (path_parts.empty()) {
-            return outcome::fail( error::Error_Code::INVALID_INPUT,
-                                  "Cannot set value on empty path" );
-    }
+    const Object_Property* current = this;
+    const std::shared_ptr<Property>* found = nullptr;
 
-    if (path_parts.size() == 1) {
-        // Direct child property
-        auto it = m_children.find(path_parts[0]);
-        if (it != m_children.end()) {
-            return it->second->set_value(value);
-        } else {
-            return outcome::fail( error::Error_Code::NOT_FOUND,
-                                     "Property not found: " + path_parts[0]);
+    for( auto part : Path_Segments( path ) ) {
+        if( current == nullptr ) {
+            return nullptr;
+        }
+        found = current->find_child( part );
+        if( found == nullptr ) {
+            return nullptr;
         }
+        current = (*found)->get_type() == schema::Property_Value_Type::OBJECT
+                ? static_cast<const Object_Property*>( found->get() )
+                : nullptr;
+    }
+    return found;
+}
+
+/**********************************/
+/*          Get Property          */
+/**********************************/
+Result<std::shared_ptr<Property>> Object_Property::get_property( std::string_view key ) const
+{
+    auto child = find_child( key );
+    if( child == nullptr ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Property not found: " + std::string( key ) );
     }
+    return outcome::ok<std::shared_ptr<Property>>( *child );
+}
 
-    // Navigate to parent
-    std::shared_ptr<Property> current = shared_from_this();
-    for (size_t i = 0; i < path_parts.size() - 1; ++i) {
-        if (current->get_type() != schema::Property_Value_Type::OBJECT) {
-            return outcome::fail( error::Error_Code::INVALID_INPUT,
-                                     "Path component '" + path_parts[i] + "' is not an object");
-        }
+/**********************************/
+/*          Remove Property       */
+/**********************************/
+Result<void> Object_Property::remove_property( std::string_view key )
+{
+    const auto atom = Key_Pool::instance().find( key );
+    const auto pos  = atom ? lower_bound( *atom ) : m_child_atoms.size();
+    if( pos >= m_child_atoms.size() || m_child_atoms[pos] != *atom ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Child property not found: " + std::string( key ) );
+    }
+    auto removed = std::move( m_children[pos] );
+    detach_child( *removed );
 
-        auto obj_prop = std::dynamic_pointer_cast<Object_Property>(current);
-        auto result = obj_prop->get_property(path_parts[i]);
-        if (!result) {
-            return outcome::fail( error::Error_Code::NOT_FOUND,
-                                     "Property not found: " + path_parts[i]);
-        }
-        current = result.value();
+    const auto offset = static_cast<std::ptrdiff_t>( pos );
+    m_child_atoms.erase( m_child_atoms.begin() + offset );
+    m_children.erase( m_children.begin() + offset );
+    stats_removed( removed->get_subtree_stats() );
+    update_hash( m_hash - child_hash_term( *removed, removed->get_content_hash() ) );
+
+    mark_structure_changed();
+    return outcome::ok();
+}
+
+/**********************************/
+/*          Resolve Path          */
+/**********************************/
+Result<std::shared_ptr<Property>> Object_Property::resolve_path( std::string_view path ) const
+{
+    return resolve_segments( Path_Segments( path ) );
+}
+
+/**********************************/
+/*     Resolve Path Segments      */
+/**********************************/
+Result<std::shared_ptr<Property>> Object_Property::resolve_path( const std::vector<Key_Atom>& path_atoms ) const
+{
+    return resolve_segments( path_atoms );
+}
+
+/**********************************/
+/*         Writable Child         */
+/**********************************/
+const std::shared_ptr<Property>* Object_Property::writable_child( std::string_view                       key,
+                                                                 const std::shared_ptr<Property_Arena>& arena,
+                                                                 uint64_t                               edit )
+{
+    auto found = find_child( key );
+    if( found == nullptr || (*found)->get_edit() == edit ) {
+        return found;
     }
 
-    // Set value on final property
-    auto final_obj = std::dynamic_pointer_cast<Object_Property>(current);
-    if (!final_obj) {
+    // Swap in a private copy; the original stays intact for whoever else holds it
+    auto& slot = m_children[static_cast<size_t>( found - m_children.data() )];
+    auto  copy = slot->clone_node( arena, edit );
+    const auto delta = static_cast<std::ptrdiff_t>( copy->get_subtree_stats().bytes ) -
+                       static_cast<std::ptrdiff_t>( slot->get_subtree_stats().bytes );
+    slot = std::move( copy );
+    attach_child( *slot );
+    adjust_bytes( delta );
+    return &slot;
+}
+
+/**********************************/
+/*          Set Path Value        */
+/**********************************/
+Result<void> Object_Property::set_path_value( std::string_view path, const std::any& value )
+{
+    if( Path_Segments( path ).empty() ) {
         return outcome::fail( error::Error_Code::INVALID_INPUT,
-                              "Final path component is not an object");
+                              "Cannot set value on empty path" );
     }
 
-    auto final_prop = final_obj->get_property(path_parts.back());
-    if (!final_prop) {
-        return final_prop.error();
+    auto prop_result = resolve_path( path );
+    if( !prop_result ) {
+        return prop_result.error();
     }
-
-    return final_prop.value()->set_value(value);
+    return prop_result.value()->set_value( value );
 }
 
 /**********************************/
@@ -194,32 +352,42 @@ Result<void> Object_Property::set_path_value(const std::string& path, const std:
 std::vector<std::string> Object_Property::get_child_keys() const
 {
     std::vector<std::string> keys;
-    keys.reserve(m_children.size());
-
-    for (const auto& [key, child] : m_children) {
-        keys.push_back(key);
-    }
-
-    std::sort(keys.begin(), keys.end());
+    keys.reserve( m_child_atoms.size() );
+    for_each_child( [&]( const std::string& key, const auto& ) {
+        keys.push_back( key );
+    } );
+    std::sort( keys.begin(), keys.end() );
     return keys;
 }
 
 /**********************************/
-/*          Split Path            */
+/*       Approximate Bytes        */
 /**********************************/
-std::vector<std::string> Object_Property::split_path(const std::string& path) const
+size_t Object_Property::approximate_bytes() const
 {
-    std::vector<std::string> parts;
-    std::stringstream ss(path);
-    std::string part;
+    return sizeof( Object_Property ) +
+           m_child_atoms.capacity() * sizeof( Key_Atom ) +
+           m_children.capacity() * sizeof( std::shared_ptr<Property> );
+}
 
-    while (std::getline(ss, part, '.')) {
-        if (!part.empty()) {
-            parts.push_back(part);
-        }
+/**********************************/
+/*         Compute Height         */
+/**********************************/
+size_t Object_Property::compute_height() const
+{
+    size_t height = 0;
+    for( const auto& child : m_children ) {
+        height = std::max( height, child->get_subtree_stats().height + 1 );
     }
+    return height;
+}
 
-    return parts;
+/**********************************/
+/*         Child Hash Term        */
+/**********************************/
+uint64_t Object_Property::child_hash_term( const Property& child, uint64_t child_hash ) const
+{
+    return content_hash::object_term( child.get_key(), child_hash );
 }
 
 /**********************************/
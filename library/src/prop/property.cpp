@@ -15,6 +15,7 @@
 
 // C++ Standard Libraries
 #include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <stdexcept>
 
@@ -27,10 +28,170 @@ namespace tmns::fcs::prop {
 /*        Constructor        */
 /*****************************/
 Property::Property(const std::string& key)
-    : m_key(key) {}
+{
+    if( auto atom = Key_Pool::instance().intern( key ) ) {
+        m_key = atom.value();
+    }
+}
 
+/*****************************/
+/*          Set Key          */
+/*****************************/
+Result<void> Property::set_key( std::string_view key )
+{
+    auto atom = Key_Pool::instance().intern( key );
+    if( !atom ) {
+        return atom.error();
+    }
+    m_key = atom.value();
+    return outcome::ok();
+}
+
+/*****************************/
+/*     Copy Constructor      */
+/*****************************/
+Property::Property( const Property& other )
+    : m_position( other.m_position ),
+      m_version( other.m_version ),
+      m_hash( other.m_hash ),
+      m_key( other.m_key ),
+      m_schema( other.m_schema ) {}
+
+/*****************************/
+/*     Set Scalar Value      */
+/*****************************/
+Result<void> Property::set_scalar_value( [[maybe_unused]] const Value& value )
+{
+    return outcome::fail( error::Error_Code::NOT_SUPPORTED,
+                          "Property '" + get_key() + "' does not hold a scalar value" );
+}
+
+/*****************************/
+/*     Get Scalar Value      */
+/*****************************/
+Result<Value> Property::get_scalar_value() const
+{
+    return outcome::fail( error::Error_Code::NOT_SUPPORTED,
+                          "Property '" + get_key() + "' does not hold a scalar value" );
+}
 
+/*****************************/
+/*     Get Subtree Stats     */
+/*****************************/
+Subtree_Stats Property::get_subtree_stats() const
+{
+    return Subtree_Stats::single( get_type(), approximate_bytes() );
+}
 
+/*****************************/
+/*        Stats Added        */
+/*****************************/
+void Property::stats_added( const Subtree_Stats& child_stats )
+{
+    size_t child_height = child_stats.height + 1;
+    for( Property* node = this; node != nullptr; node = node->m_parent ) {
+        auto stats = node->container_stats();
+        stats->node_count += child_stats.node_count;
+        for( size_t i = 0; i < Subtree_Stats::TYPE_COUNT; ++i ) {
+            stats->type_counts[i] += child_stats.type_counts[i];
+        }
+        stats->bytes  += child_stats.bytes;
+        stats->height  = std::max( stats->height, child_height );
+        child_height   = stats->height + 1;
+    }
+}
+
+/*****************************/
+/*       Stats Removed       */
+/*****************************/
+void Property::stats_removed( const Subtree_Stats& child_stats )
+{
+    // Heights only need rechecking while the removed branch was the tallest
+    bool recheck = container_stats()->height == child_stats.height + 1;
+    for( Property* node = this; node != nullptr; node = node->m_parent ) {
+        auto stats = node->container_stats();
+        stats->node_count -= child_stats.node_count;
+        for( size_t i = 0; i < Subtree_Stats::TYPE_COUNT; ++i ) {
+            stats->type_counts[i] -= child_stats.type_counts[i];
+        }
+        stats->bytes -= child_stats.bytes;
+        if( recheck ) {
+            const auto height = node->compute_height();
+            recheck = height != stats->height;
+            stats->height = height;
+        }
+    }
+}
 
+/*****************************/
+/*       Adjust Bytes        */
+/*****************************/
+void Property::adjust_bytes( std::ptrdiff_t delta )
+{
+    if( delta == 0 ) {
+        return;
+    }
+    for( Property* node = this; node != nullptr; node = node->m_parent ) {
+        if( auto stats = node->container_stats() ) {
+            stats->bytes = static_cast<size_t>( static_cast<std::ptrdiff_t>( stats->bytes ) + delta );
+        }
+    }
+}
+
+/*****************************/
+/*        Update Hash        */
+/*****************************/
+void Property::update_hash( uint64_t hash )
+{
+    auto before = m_hash;
+    m_hash = hash;
+    const Property* child = this;
+    for( Property* node = m_parent; node != nullptr && before != hash; node = node->m_parent ) {
+        const auto node_before = node->m_hash;
+        node->m_hash = node_before - node->child_hash_term( *child, before ) + node->child_hash_term( *child, hash );
+        before = node_before;
+        hash   = node->m_hash;
+        child  = node;
+    }
+}
+
+/*****************************/
+/*   Mark Structure Changed  */
+/*****************************/
+void Property::mark_structure_changed()
+{
+    for( Property* node = this; node != nullptr; node = node->m_parent ) {
+        node->m_structure_generation = next_generation();
+    }
+    m_version = m_structure_generation;
+}
+
+/*****************************/
+/*       Attach Child        */
+/*****************************/
+void Property::attach_child( Property& child, size_t position )
+{
+    child.m_parent   = this;
+    child.m_position = position;
+}
+
+/*****************************/
+/*       Detach Child        */
+/*****************************/
+void Property::detach_child( Property& child )
+{
+    if( child.m_parent == this ) {
+        child.m_parent = nullptr;
+    }
+}
+
+/*****************************/
+/*   Next Generation Stamp   */
+/*****************************/
+uint64_t Property::next_generation()
+{
+    static std::atomic<uint64_t> s_generation{ 1 };
+    return s_generation.fetch_add( 1, std::memory_order_relaxed );
+}
 
 } // namespace tmns::fcs::prop
\ No newline at end of file
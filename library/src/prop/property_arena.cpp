@@ -0,0 +1,102 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    property_arena.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/prop/property_arena.hpp>
+
+namespace tmns::fcs::prop {
+
+/*****************************/
+/*        Constructor        */
+/*****************************/
+Property_Arena::Property_Arena( std::pmr::memory_resource* upstream )
+    : m_upstream( upstream ),
+      m_pool( &m_upstream )
+{}
+
+/*****************************/
+/*           Stats           */
+/*****************************/
+Property_Arena::Stats Property_Arena::stats() const
+{
+    Stats output;
+    output.bytes_in_use      = m_bytes_in_use.load( std::memory_order_relaxed );
+    output.peak_bytes_in_use = m_peak_bytes_in_use.load( std::memory_order_relaxed );
+    output.live_allocations  = m_live_allocations.load( std::memory_order_relaxed );
+    output.total_allocations = m_total_allocations.load( std::memory_order_relaxed );
+    output.upstream_bytes    = m_upstream.bytes();
+    return output;
+}
+
+/*****************************/
+/*         Allocate          */
+/*****************************/
+void* Property_Arena::do_allocate( size_t bytes, size_t alignment )
+{
+    void* ptr = m_pool.allocate( bytes, alignment );
+
+    const auto in_use = m_bytes_in_use.fetch_add( bytes, std::memory_order_relaxed ) + bytes;
+    auto peak = m_peak_bytes_in_use.load( std::memory_order_relaxed );
+    while( in_use > peak &&
+           !m_peak_bytes_in_use.compare_exchange_weak( peak, in_use, std::memory_order_relaxed ) ) {}
+    m_live_allocations.fetch_add( 1, std::memory_order_relaxed );
+    m_total_allocations.fetch_add( 1, std::memory_order_relaxed );
+    return ptr;
+}
+
+/*****************************/
+/*        Deallocate         */
+/*****************************/
+void Property_Arena::do_deallocate( void* ptr, size_t bytes, size_t alignment )
+{
+    m_pool.deallocate( ptr, bytes, alignment );
+    m_bytes_in_use.fetch_sub( bytes, std::memory_order_relaxed );
+    m_live_allocations.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+/*****************************/
+/*         Is Equal          */
+/*****************************/
+bool Property_Arena::do_is_equal( const std::pmr::memory_resource& other ) const noexcept
+{
+    return this == &other;
+}
+
+/*****************************/
+/*   Upstream - Allocate     */
+/*****************************/
+void* Property_Arena::Counting_Upstream::do_allocate( size_t bytes, size_t alignment )
+{
+    void* ptr = m_upstream->allocate( bytes, alignment );
+    m_bytes.fetch_add( bytes, std::memory_order_relaxed );
+    return ptr;
+}
+
+/*****************************/
+/*   Upstream - Deallocate   */
+/*****************************/
+void Property_Arena::Counting_Upstream::do_deallocate( void* ptr, size_t bytes, size_t alignment )
+{
+    m_upstream->deallocate( ptr, bytes, alignment );
+    m_bytes.fetch_sub( bytes, std::memory_order_relaxed );
+}
+
+/*****************************/
+/*   Upstream - Is Equal     */
+/*****************************/
+bool Property_Arena::Counting_Upstream::do_is_equal( const std::pmr::memory_resource& other ) const noexcept
+{
+    return this == &other;
+}
+
+} // End of tmns::fcs::prop namespace
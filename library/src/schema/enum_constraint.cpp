@@ -33,25 +33,43 @@ Enum_Constraint::Enum_Constraint( const std::vector<std::string>& allowed_values
 /*        Validate         */
 /***************************/
 Result<void> Enum_Constraint::validate( const std::any& value ) const {
-    try {
-        std::string str_value = std::any_cast<std::string>(value);
-        auto it = std::find(m_allowed_values.begin(), m_allowed_values.end(), str_value);
-        if (it == m_allowed_values.end()) {
-            std::ostringstream oss;
-            oss << "Value '" << str_value << "' is not in allowed values: [";
-            for (size_t i = 0; i < m_allowed_values.size(); ++i) {
-                if (i > 0) oss << ", ";
-                oss << "'" << m_allowed_values[i] << "'";
-            }
-            oss << "]";
-            return outcome::fail( error::Error_Code::INVALID_CONFIGURATION,
-                                  oss.str() );
-        }
-        return outcome::ok();
-    } catch (const std::bad_any_cast& e) {
+    auto str_value = std::any_cast<std::string>( &value );
+    if( str_value == nullptr ) {
+        return outcome::fail( error::Error_Code::INVALID_CONFIGURATION,
+                              "Value is not a string");
+    }
+    return check_allowed( *str_value );
+}
+
+/***************************/
+/*      Validate Value     */
+/***************************/
+Result<void> Enum_Constraint::validate_value( const Value& value ) const {
+    auto str_value = std::get_if<std::string>( &value );
+    if( str_value == nullptr ) {
         return outcome::fail( error::Error_Code::INVALID_CONFIGURATION,
                               "Value is not a string");
     }
+    return check_allowed( *str_value );
+}
+
+/***************************/
+/*      Check Allowed      */
+/***************************/
+Result<void> Enum_Constraint::check_allowed( const std::string& str_value ) const {
+    auto it = std::find(m_allowed_values.begin(), m_allowed_values.end(), str_value);
+    if (it == m_allowed_values.end()) {
+        std::ostringstream oss;
+        oss << "Value '" << str_value << "' is not in allowed values: [";
+        for (size_t i = 0; i < m_allowed_values.size(); ++i) {
+            if (i > 0) oss << ", ";
+            oss << "'" << m_allowed_values[i] << "'";
+        }
+        oss << "]";
+        return outcome::fail( error::Error_Code::INVALID_CONFIGURATION,
+                              oss.str() );
+    }
+    return outcome::ok();
 }
 
 /***************************/
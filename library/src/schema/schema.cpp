@@ -65,7 +65,10 @@ const std::vector<std::shared_ptr<Constraint_Iface>>& Schema::get_constraints()
 /*       Validate          */
 /***************************/
 Result<void> Schema::validate(const std::any& value) const {
-    // Check all constraints
+    // Scalars take the Value path; anything else is left to the constraints
+    if( auto scalar = value_from_any( value ) ) {
+        return validate_value( *scalar );
+    }
     for (const auto& constraint : m_constraints) {
         auto result = constraint->validate(value);
         if (!result) {
@@ -75,6 +78,19 @@ Result<void> Schema::validate(const std::any& value) const {
     return outcome::ok();
 }
 
+/***************************/
+/*     Validate Value      */
+/***************************/
+Result<void> Schema::validate_value( const Value& value ) const {
+    for (const auto& constraint : m_constraints) {
+        auto result = constraint->validate_value(value);
+        if (!result) {
+            return result;
+        }
+    }
+    return outcome::ok();
+}
+
 /********************************/
 /*       Validate Property      */
 /********************************/
@@ -88,9 +104,9 @@ Result<void> Schema::validate_property( const prop::Property& property ) const
     }
 
     // Validate the property's value
-    auto value_result = property.get_value();
+    auto value_result = property.get_scalar_value();
     if( value_result ) {
-        return validate( value_result.value() );
+        return validate_value( value_result.value() );
     }
 
     // If property doesn't have a value but is required, fail
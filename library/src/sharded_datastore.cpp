@@ -0,0 +1,211 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    sharded_datastore.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/sharded_datastore.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <string>
+
+// Project Libraries
+#include <terminus/fcs/prop/path_segments.hpp>
+
+namespace tmns::fcs {
+
+/********************************/
+/*     Router Constructor       */
+/********************************/
+Shard_Router::Shard_Router( size_t shard_count, size_t key_depth )
+  : m_shard_count( std::max<size_t>( shard_count, 1 ) ),
+    m_key_depth( std::max<size_t>( key_depth, 1 ) )
+{}
+
+/********************************/
+/*             Route            */
+/********************************/
+Result<size_t> Shard_Router::route( std::string_view path ) const
+{
+    size_t hash  = 0;
+    size_t depth = 0;
+    for( auto segment : prop::Path_Segments( path ) ) {
+        hash = hash * 31 + std::hash<std::string_view>{}( segment );
+        if( ++depth == m_key_depth ) {
+            return outcome::ok<size_t>( hash % m_shard_count );
+        }
+    }
+    return outcome::fail( error::Error_Code::INVALID_INPUT,
+                          "Path needs at least " + std::to_string( m_key_depth ) +
+                          " components to pick a shard: " + std::string( path ) );
+}
+
+/********************************/
+/*     Snapshot Constructor     */
+/********************************/
+Sharded_Snapshot::Sharded_Snapshot( Shard_Router                                 router,
+                                    std::vector<std::shared_ptr<const Snapshot>> shards )
+  : m_router( router ),
+    m_shards( std::move( shards ) )
+{}
+
+/********************************/
+/*       Get Scalar Value       */
+/********************************/
+Result<Value> Sharded_Snapshot::get_scalar_value( std::string_view path ) const
+{
+    auto shard = find_shard( path );
+    if( !shard ) {
+        return shard.error();
+    }
+    return shard.value()->get_scalar_value( path );
+}
+
+/********************************/
+/*         Has Property         */
+/********************************/
+bool Sharded_Snapshot::has_property( std::string_view path ) const
+{
+    auto shard = find_shard( path );
+    return shard && shard.value()->has_property( path );
+}
+
+/********************************/
+/*          Find Shard          */
+/********************************/
+Result<const Snapshot*> Sharded_Snapshot::find_shard( std::string_view path ) const
+{
+    auto index = m_router.route( path );
+    if( !index ) {
+        return index.error();
+    }
+    return outcome::ok<const Snapshot*>( m_shards[index.value()].get() );
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Sharded_Datastore::Sharded_Datastore( size_t shard_count, size_t key_depth )
+  : m_router( shard_count, key_depth )
+{
+    m_shards.reserve( m_router.shard_count() );
+    for( size_t i = 0; i < m_router.shard_count(); ++i ) {
+        m_shards.push_back( std::make_unique<Datastore>( Concurrency::SNAPSHOT ) );
+    }
+}
+
+/********************************/
+/*        Insert Property       */
+/********************************/
+Result<void> Sharded_Datastore::insert_property( std::string_view                path,
+                                                 std::shared_ptr<prop::Property> property )
+{
+    auto shard = route( path );
+    if( !shard ) {
+        return shard.error();
+    }
+    return shard.value()->insert_property( path, std::move( property ) );
+}
+
+/********************************/
+/*        Remove Property       */
+/********************************/
+Result<void> Sharded_Datastore::remove_property( std::string_view path )
+{
+    auto shard = route( path );
+    if( !shard ) {
+        return shard.error();
+    }
+    return shard.value()->remove_property( path );
+}
+
+/********************************/
+/*       Set Scalar Value       */
+/********************************/
+Result<void> Sharded_Datastore::set_scalar_value( std::string_view path, const Value& value )
+{
+    auto shard = route( path );
+    if( !shard ) {
+        return shard.error();
+    }
+    return shard.value()->set_scalar_value( path, value );
+}
+
+/********************************/
+/*       Get Scalar Value       */
+/********************************/
+Result<Value> Sharded_Datastore::get_scalar_value( std::string_view path ) const
+{
+    auto shard = route( path );
+    if( !shard ) {
+        return shard.error();
+    }
+    return shard.value()->snapshot()->get_scalar_value( path );
+}
+
+/********************************/
+/*         Has Property         */
+/********************************/
+bool Sharded_Datastore::has_property( std::string_view path ) const
+{
+    auto shard = route( path );
+    return shard && shard.value()->snapshot()->has_property( path );
+}
+
+/********************************/
+/*           Snapshot           */
+/********************************/
+Sharded_Snapshot Sharded_Datastore::snapshot() const
+{
+    // Writers publish before releasing their shard lock, so holding every lock
+    // at once means no write is half-visible.  Locks are taken in shard order.
+    std::vector<std::unique_lock<std::recursive_mutex>> locks;
+    locks.reserve( m_shards.size() );
+    for( const auto& shard : m_shards ) {
+        locks.push_back( shard->lock() );
+    }
+
+    std::vector<std::shared_ptr<const Snapshot>> snapshots;
+    snapshots.reserve( m_shards.size() );
+    for( const auto& shard : m_shards ) {
+        snapshots.push_back( shard->snapshot() );
+    }
+    return Sharded_Snapshot( m_router, std::move( snapshots ) );
+}
+
+/********************************/
+/*             Size             */
+/********************************/
+size_t Sharded_Datastore::size() const
+{
+    size_t total = 0;
+    for( const auto& shard : m_shards ) {
+        total += shard->snapshot()->size();
+    }
+    return total;
+}
+
+/********************************/
+/*             Route            */
+/********************************/
+Result<Datastore*> Sharded_Datastore::route( std::string_view path ) const
+{
+    auto index = m_router.route( path );
+    if( !index ) {
+        return index.error();
+    }
+    return outcome::ok<Datastore*>( m_shards[index.value()].get() );
+}
+
+} // End of tmns::fcs namespace
@@ -0,0 +1,84 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    snapshot.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/snapshot.hpp>
+
+namespace tmns::fcs {
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Snapshot::Snapshot( std::shared_ptr<const prop::Object_Property> root, uint64_t version )
+  : m_root( std::move( root ) ),
+    m_version( version )
+{}
+
+/********************************/
+/*             View             */
+/********************************/
+prop::Property_View Snapshot::view( std::string_view path ) const
+{
+    if( prop::Path_Segments( path ).empty() ) {
+        return root_view();
+    }
+    return prop::Property_View( find( path ) );
+}
+
+/********************************/
+/*       Get Scalar Value       */
+/********************************/
+Result<Value> Snapshot::get_scalar_value( std::string_view path ) const
+{
+    auto property = find( path );
+    if( property == nullptr ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Property not found: " + std::string( path ) );
+    }
+    return property->get_scalar_value();
+}
+
+/********************************/
+/*          Get Version         */
+/********************************/
+Result<uint64_t> Snapshot::get_version( std::string_view path ) const
+{
+    auto property = find( path );
+    if( property == nullptr ) {
+        return outcome::fail( error::Error_Code::NOT_FOUND,
+                              "Property not found: " + std::string( path ) );
+    }
+    return outcome::ok<uint64_t>( property->get_version() );
+}
+
+/********************************/
+/*             Stats            */
+/********************************/
+prop::Subtree_Stats Snapshot::stats() const
+{
+    auto stats = m_root->get_subtree_stats();
+    stats.node_count -= 1;
+    stats.type_counts[static_cast<size_t>( schema::Property_Value_Type::OBJECT )] -= 1;
+    return stats;
+}
+
+/********************************/
+/*             Find             */
+/********************************/
+const prop::Property* Snapshot::find( std::string_view path ) const
+{
+    auto found = m_root->find_path( path );
+    return found ? found->get() : nullptr;
+}
+
+} // End of tmns::fcs namespace
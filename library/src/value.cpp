@@ -0,0 +1,45 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    value.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <terminus/fcs/value.hpp>
+
+namespace tmns::fcs {
+
+static_assert( std::variant_size_v<Value> == static_cast<size_t>( schema::Property_Value_Type::PATH ) + 1 );
+static_assert( std::is_same_v<std::variant_alternative_t<static_cast<size_t>( schema::Property_Value_Type::INTEGER ), Value>, int64_t> );
+static_assert( std::is_same_v<std::variant_alternative_t<static_cast<size_t>( schema::Property_Value_Type::BOOLEAN ), Value>, bool> );
+
+/******************************/
+/*        Value to Any        */
+/******************************/
+std::any value_to_any( const Value& value )
+{
+    return std::visit( []( const auto& alternative ) { return std::any( alternative ); }, value );
+}
+
+/******************************/
+/*       Value from Any       */
+/******************************/
+std::optional<Value> value_from_any( const std::any& value )
+{
+    if( auto ptr = std::any_cast<std::string>( &value ) )           { return Value( *ptr ); }
+    if( auto ptr = std::any_cast<int64_t>( &value ) )               { return Value( *ptr ); }
+    if( auto ptr = std::any_cast<float>( &value ) )                 { return Value( *ptr ); }
+    if( auto ptr = std::any_cast<double>( &value ) )                { return Value( *ptr ); }
+    if( auto ptr = std::any_cast<bool>( &value ) )                  { return Value( *ptr ); }
+    if( auto ptr = std::any_cast<std::filesystem::path>( &value ) ) { return Value( *ptr ); }
+    return std::nullopt;
+}
+
+} // End of tmns::fcs namespace
@@ -0,0 +1,142 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_async_dispatcher.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/notify/async_dispatcher.hpp>
+#include <terminus/fcs/notify/bounded_queue.hpp>
+
+using namespace tmns::fcs;
+
+/***********************************/
+/*          Bounded Queue          */
+/***********************************/
+TEST( fcs_notify_Async_Dispatcher, bounded_queue )
+{
+    notify::Bounded_Queue<int> queue( 3 );
+    EXPECT_EQ(queue.capacity(), 4u);
+
+    for( int i = 0; i < 4; ++i ) {
+        EXPECT_TRUE(queue.try_push( i ));
+    }
+    int extra = 99;
+    EXPECT_FALSE(queue.try_push( extra ));
+    EXPECT_EQ(queue.size(), 4u);
+
+    int value = -1;
+    for( int i = 0; i < 4; ++i ) {
+        ASSERT_TRUE(queue.try_pop( value ));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.try_pop( value ));
+
+    // Many producers, one consumer
+    notify::Bounded_Queue<int> shared( 1024 );
+    std::vector<std::thread> producers;
+    for( int p = 0; p < 4; ++p ) {
+        producers.emplace_back( [&shared]() {
+            for( int i = 0; i < 200; ++i ) {
+                int item = 1;
+                while( !shared.try_push( item ) ) {
+                    std::this_thread::yield();
+                }
+            }
+        } );
+    }
+    for( auto& producer : producers ) {
+        producer.join();
+    }
+    int total = 0;
+    while( shared.try_pop( value ) ) {
+        total += value;
+    }
+    EXPECT_EQ(total, 800);
+}
+
+/***********************************/
+/*     Coalescing And Dropping     */
+/***********************************/
+TEST( fcs_notify_Async_Dispatcher, coalesce_and_drop )
+{
+    EXPECT_FALSE(Datastore().enable_async_dispatch());
+
+    Datastore datastore( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(datastore.insert_property("app.port", datastore.make_property<prop::Integer_Property>("", 0)));
+    ASSERT_TRUE(datastore.insert_property("app.host", datastore.make_property<prop::String_Property>("", "")));
+    ASSERT_TRUE(datastore.enable_async_dispatch( 16 ));
+
+    std::mutex gate;
+    std::mutex seen_mutex;
+    std::vector<int64_t> seen;
+    std::atomic<int> host_changes{ 0 };
+    const auto writer_thread = std::this_thread::get_id();
+
+    datastore.add_change_listener( "app.port", [&]( std::string_view, const prop::Property* property ) {
+        EXPECT_NE(std::this_thread::get_id(), writer_thread);
+        std::lock_guard<std::mutex> block( gate );
+        std::lock_guard<std::mutex> lock( seen_mutex );
+        seen.push_back( *prop::typed_value_ptr<int64_t>( property ) );
+    } );
+    datastore.add_change_listener( "app.host", [&]( std::string_view, const prop::Property* ) { ++host_changes; } );
+
+    // Hold the listener so that later writes pile up in the queue
+    std::unique_lock<std::mutex> hold( gate );
+    ASSERT_TRUE(datastore.set<int64_t>("app.port", 1));
+    while( datastore.dispatch_stats().queue_depth != 0 ) {
+        std::this_thread::yield();
+    }
+    for( int64_t i = 2; i <= 10; ++i ) {
+        ASSERT_TRUE(datastore.set<int64_t>("app.port", i));
+    }
+    ASSERT_TRUE(datastore.set<std::string>("app.host", "example.com"));
+    hold.unlock();
+    datastore.flush_notifications();
+
+    // The nine queued port writes collapse into the last one
+    EXPECT_EQ(seen, (std::vector<int64_t>{ 1, 10 }));
+    EXPECT_EQ(host_changes.load(), 1);
+    auto stats = datastore.dispatch_stats();
+    EXPECT_EQ(stats.posted, 11u);
+    EXPECT_EQ(stats.delivered, 3u);
+    EXPECT_EQ(stats.coalesced, 8u);
+    EXPECT_EQ(stats.overflowed, 0u);
+    EXPECT_EQ(stats.queue_depth, 0u);
+
+    // A full queue holds new events aside instead of blocking the writer or losing the latest value
+    hold.lock();
+    ASSERT_TRUE(datastore.set<int64_t>("app.port", 11));
+    while( datastore.dispatch_stats().queue_depth != 0 ) {
+        std::this_thread::yield();
+    }
+    for( int64_t i = 0; i < 20; ++i ) {
+        ASSERT_TRUE(datastore.set<int64_t>("app.port", 100 + i));
+    }
+    EXPECT_EQ(datastore.dispatch_stats().overflowed, 4u);
+    hold.unlock();
+    datastore.flush_notifications();
+    EXPECT_EQ(seen.back(), 119);
+    EXPECT_EQ(datastore.dispatch_stats().queue_depth, 0u);
+
+    datastore.disable_async_dispatch();
+    EXPECT_EQ(datastore.dispatch_stats().posted, 0u);
+}
@@ -23,6 +23,7 @@
 // Terminus Libraries
 #include <terminus/fcs/config_file_parser.hpp>
 #include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/prop/array_property.hpp>
 
 using namespace tmns::fcs;
 
@@ -209,6 +210,21 @@ flags = [true, false, true]
 
     // Check if parsing succeeded
     ASSERT_TRUE(result) << "Parsing failed: " << result.error().message();
+    auto ports = std::dynamic_pointer_cast<prop::Array_Property>(datastore.get_property("ports").value());
+    ASSERT_NE(ports, nullptr);
+    EXPECT_EQ(ports->size(), 3u);
+
+    // Parsing again appends through the datastore, leaving clones and fetched arrays alone
+    auto copy = datastore.clone();
+    ASSERT_TRUE(parser.parse_file(test_file, datastore, std::nullopt));
+    auto appended = std::dynamic_pointer_cast<prop::Array_Property>(datastore.get_property("ports").value());
+    auto copied   = std::dynamic_pointer_cast<prop::Array_Property>(copy.get_property("ports").value());
+    ASSERT_NE(appended, nullptr);
+    ASSERT_NE(copied, nullptr);
+    EXPECT_EQ(appended->size(), 6u);
+    EXPECT_EQ(copied->size(), 3u);
+    EXPECT_EQ(ports->size(), 3u);
+    EXPECT_NE(datastore.get_root()->get_content_hash(), copy.get_root()->get_content_hash());
 }
 
 /*******************************************/
@@ -15,10 +15,16 @@
 #include <gtest/gtest.h>
 
 // C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 // Terminus Libraries
 #include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/diff.hpp>
 #include <terminus/fcs/schema/schema.hpp>
 #include <terminus/fcs/schema/builder.hpp>
 #include <terminus/fcs/prop/typed_property.hpp>
@@ -202,3 +208,955 @@ TEST_F( fcs_Datastore, create_property_dynamically )
     auto result = datastore->set_property("test_prop", std::string("test_value"));
     ASSERT_TRUE(result) << "Setting property failed: " << result.error().message();
 }
+
+/***********************************/
+/*      Datastore Tests            */
+/***********************************/
+TEST_F( fcs_Datastore, path_handle_get_and_set )
+{
+    auto app_obj   = std::make_shared<tmns::fcs::prop::Object_Property>("app");
+    auto port_prop = std::make_shared<tmns::fcs::prop::Integer_Property>("port");
+    ASSERT_TRUE(datastore->get_root()->add_property(app_obj));
+    ASSERT_TRUE(app_obj->add_property(port_prop));
+
+    auto handle = datastore->compile_path("app.port");
+    ASSERT_EQ(handle.get_segments().size(), 2u);
+
+    auto set_result = datastore->set_property(handle, int64_t{8080});
+    ASSERT_TRUE(set_result) << "Setting through handle failed: " << set_result.error().message();
+
+    auto get_result = datastore->get_property(handle);
+    ASSERT_TRUE(get_result) << "Getting through handle failed: " << get_result.error().message();
+    EXPECT_EQ(get_result.value(), port_prop);
+    EXPECT_EQ(port_prop->get_typed_value().value(), 8080);
+
+    // Unknown paths fail the same way as string lookups
+    auto missing = datastore->compile_path("app.missing");
+    auto missing_result = datastore->get_property(missing);
+    ASSERT_FALSE(missing_result);
+    EXPECT_EQ(missing_result.error().code(), tmns::error::Error_Code::NOT_FOUND);
+}
+
+/***********************************/
+/*      Datastore Tests            */
+/***********************************/
+TEST_F( fcs_Datastore, path_handle_reresolves_after_shape_change )
+{
+    auto app_obj   = std::make_shared<tmns::fcs::prop::Object_Property>("app");
+    auto port_prop = std::make_shared<tmns::fcs::prop::Integer_Property>("port", 1);
+    ASSERT_TRUE(datastore->get_root()->add_property(app_obj));
+    ASSERT_TRUE(app_obj->add_property(port_prop));
+
+    auto handle = datastore->compile_path("app.port");
+    ASSERT_TRUE(datastore->get_property(handle));
+
+    // Replace the leaf directly on the subtree; the handle must notice
+    auto new_port = std::make_shared<tmns::fcs::prop::Integer_Property>("port", 2);
+    ASSERT_TRUE(app_obj->add_property(new_port));
+
+    auto result = datastore->get_property(handle);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.value(), new_port);
+
+    // Removing it must invalidate the handle as well
+    ASSERT_TRUE(datastore->remove_property("app.port"));
+    EXPECT_FALSE(datastore->get_property(handle));
+
+    // Clearing the datastore swaps in a new root
+    ASSERT_TRUE(app_obj->add_property(new_port));
+    ASSERT_TRUE(datastore->get_property(handle));
+    datastore->clear();
+    EXPECT_FALSE(datastore->get_property(handle));
+}
+
+/***********************************/
+/*      Path Index Upkeep          */
+/***********************************/
+TEST_F( fcs_Datastore, path_index_read_only_for_readers )
+{
+    for( int i = 0; i < 64; ++i ) {
+        ASSERT_TRUE(datastore->insert_property("app.values.value_" + std::to_string( i ),
+                                               std::make_shared<prop::Integer_Property>("", i)));
+    }
+
+    // Const readers never write the index, so they may run together without a writer
+    const Datastore& reader = *datastore;
+    std::atomic<int> mismatches{ 0 };
+    std::vector<std::thread> threads;
+    for( int t = 0; t < 4; ++t ) {
+        threads.emplace_back( [&]() {
+            for( int round = 0; round < 100; ++round ) {
+                for( int i = 0; i < 64; ++i ) {
+                    if( reader.get_or<int64_t>("app.values.value_" + std::to_string( i ), -1) != i ) {
+                        ++mismatches;
+                    }
+                }
+            }
+        });
+    }
+    for( auto& thread : threads ) {
+        thread.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+
+    // Restructuring a fetched object directly is seen at once, and the next write re-indexes
+    auto values = std::static_pointer_cast<prop::Object_Property>(datastore->get_property("app.values").value());
+    ASSERT_TRUE(values->remove_property("value_0"));
+    ASSERT_TRUE(values->add_property(std::make_shared<prop::Integer_Property>("extra", 7)));
+    EXPECT_FALSE(datastore->has_property("app.values.value_0").value());
+    EXPECT_EQ(datastore->get_or<int64_t>("app.values.extra", 0), 7);
+    ASSERT_TRUE(datastore->set<int64_t>("app.values.value_1", 100));
+    EXPECT_FALSE(datastore->has_property("app.values.value_0").value());
+    EXPECT_EQ(datastore->get_or<int64_t>("app.values.extra", 0), 7);
+    EXPECT_EQ(datastore->get_or<int64_t>("app.values.value_1", 0), 100);
+}
+
+/***********************************/
+/*      Datastore Tests            */
+/***********************************/
+TEST_F( fcs_Datastore, string_view_lookup )
+{
+    auto app_obj   = std::make_shared<tmns::fcs::prop::Object_Property>("app");
+    auto host_prop = std::make_shared<tmns::fcs::prop::String_Property>("host", "localhost");
+    ASSERT_TRUE(datastore->get_root()->add_property(app_obj));
+    ASSERT_TRUE(app_obj->add_property(host_prop));
+
+    // Views into a larger buffer must not need a terminated std::string
+    std::string buffer = "app.host=ignored";
+    std::string_view path = std::string_view(buffer).substr(0, 8);
+
+    auto result = datastore->get_property(path);
+    ASSERT_TRUE(result) << "Lookup failed: " << result.error().message();
+    EXPECT_EQ(result.value(), host_prop);
+
+    // Empty components are skipped
+    EXPECT_TRUE(datastore->get_property(".app..host."));
+    EXPECT_TRUE(app_obj->get_property(std::string_view("host")));
+
+    // Removal through a view
+    ASSERT_TRUE(datastore->remove_property(path));
+    EXPECT_FALSE(datastore->get_property("app.host"));
+}
+
+/***********************************/
+/*      Arena Allocation Tests     */
+/***********************************/
+TEST_F( fcs_Datastore, arena_allocation_and_clear )
+{
+    const auto empty = datastore->arena_stats();
+    EXPECT_EQ(empty.live_allocations, 1u); // root
+
+    for( int i = 0; i < 500; ++i ) {
+        auto path = "arena.group_" + std::to_string(i % 10) + ".key_" + std::to_string(i);
+        ASSERT_TRUE(datastore->insert_property(path, datastore->make_property<prop::Integer_Property>("", i)));
+    }
+
+    // 500 leaves, 10 groups and "arena" on top of the root
+    const auto loaded = datastore->arena_stats();
+    EXPECT_EQ(loaded.live_allocations, 512u);
+    EXPECT_GT(loaded.bytes_in_use, empty.bytes_in_use);
+    EXPECT_GE(loaded.upstream_bytes, loaded.bytes_in_use);
+
+    // Nodes handed out stay valid after the datastore starts a new arena
+    auto survivor = datastore->get_property("arena.group_3.key_13").value();
+    datastore->clear();
+    EXPECT_EQ(datastore->arena_stats().live_allocations, 1u);
+    EXPECT_EQ(datastore->arena_stats().total_allocations, 1u);
+    EXPECT_EQ(std::any_cast<int64_t>(survivor->get_value().value()), 13);
+
+    auto created = datastore->make_property<prop::Integer_Property>("made", 4);
+    EXPECT_EQ(datastore->arena_stats().live_allocations, 2u);
+    created.reset();
+    EXPECT_EQ(datastore->arena_stats().live_allocations, 1u);
+}
+
+/***********************************/
+/*      Typed Accessor Tests       */
+/***********************************/
+TEST_F( fcs_Datastore, typed_get_set )
+{
+    ASSERT_TRUE(datastore->insert_property("server.host", datastore->make_property<prop::String_Property>("", "localhost")));
+    ASSERT_TRUE(datastore->insert_property("server.port", datastore->make_property<prop::Integer_Property>("", 8080)));
+    ASSERT_TRUE(datastore->insert_property("server.tls", datastore->make_property<prop::Boolean_Property>("", true)));
+
+    auto port = datastore->get<int64_t>("server.port");
+    ASSERT_TRUE(port);
+    EXPECT_EQ(port.value(), 8080);
+
+    // Strings come back as views into the stored value
+    auto host = datastore->get<std::string>("server.host");
+    ASSERT_TRUE(host);
+    EXPECT_EQ(host.value(), "localhost");
+    EXPECT_EQ(host.value().data(), datastore->try_get<std::string>("server.host")->data());
+
+    // Missing paths and mismatched types
+    auto missing = datastore->get<int64_t>("server.workers");
+    ASSERT_FALSE(missing);
+    EXPECT_EQ(missing.error().code(), tmns::error::Error_Code::NOT_FOUND);
+    auto mismatch = datastore->get<double>("server.port");
+    ASSERT_FALSE(mismatch);
+    EXPECT_EQ(mismatch.error().code(), tmns::error::Error_Code::TYPE_MISMATCH);
+    EXPECT_EQ(datastore->try_get<bool>("server.port"), nullptr);
+    EXPECT_EQ(datastore->try_get<int64_t>("server"), nullptr);
+
+    EXPECT_EQ(datastore->get_or<int64_t>("server.workers", 4), 4);
+    EXPECT_EQ(datastore->get_or<int64_t>("server.port", 4), 8080);
+    EXPECT_EQ(datastore->get_or<std::string>("server.name", "default"), "default");
+
+    // set<T> only updates existing properties of the same type
+    ASSERT_TRUE(datastore->set<int64_t>("server.port", 9090));
+    EXPECT_EQ(*datastore->try_get<int64_t>("server.port"), 9090);
+    ASSERT_TRUE(datastore->set<std::string>("server.host", "example.com"));
+    EXPECT_EQ(datastore->get<std::string>("server.host").value(), "example.com");
+    EXPECT_FALSE(datastore->set<bool>("server.port", false));
+    EXPECT_FALSE(datastore->set<bool>("server.missing", false));
+    EXPECT_TRUE(datastore->get<bool>("server.tls").value());
+}
+
+/***********************************/
+/*      Property View Tests        */
+/***********************************/
+TEST_F( fcs_Datastore, property_views_borrow )
+{
+    auto port = datastore->make_property<prop::Integer_Property>("", 8080);
+    ASSERT_TRUE(datastore->insert_property("server.port", port));
+    auto hosts = datastore->make_property<prop::Array_Property>("");
+    ASSERT_TRUE(hosts->add_item(datastore->make_property<prop::String_Property>("", "alpha")));
+    ASSERT_TRUE(hosts->add_item(datastore->make_property<prop::String_Property>("", "beta")));
+    ASSERT_TRUE(datastore->insert_property("server.hosts", hosts));
+
+    const auto port_refs = port.use_count();
+
+    // Views do not take references
+    auto port_view = datastore->view("server.port");
+    ASSERT_TRUE(port_view);
+    EXPECT_EQ(port_view.get(), port.get());
+    EXPECT_EQ(*port_view.as<int64_t>(), 8080);
+    EXPECT_EQ(port_view.as<std::string>(), nullptr);
+    EXPECT_EQ(port.use_count(), port_refs);
+
+    // Walking from the root only reads the tree
+    auto server = datastore->root_view().find("server");
+    ASSERT_TRUE(server);
+    EXPECT_EQ(server.size(), 2u);
+    EXPECT_EQ(server.find("port").get(), port.get());
+    EXPECT_EQ(*server.find("hosts").item(1).as<std::string>(), "beta");
+    EXPECT_FALSE(server.find("hosts").item(2));
+    EXPECT_FALSE(server.find("port").find("anything"));
+    EXPECT_FALSE(datastore->view("server.missing"));
+    EXPECT_EQ(datastore->view("").get(), datastore->get_root().get());
+
+    auto handle = datastore->compile_path("server.port");
+    EXPECT_EQ(datastore->view(handle).get(), port.get());
+    EXPECT_EQ(datastore->view(handle).get(), port.get());
+}
+
+/***********************************/
+/*      Subtree Stats Tests        */
+/***********************************/
+TEST_F( fcs_Datastore, stats_track_mutations )
+{
+    // Reference walk to compare the incremental aggregates against
+    auto recount = []( const auto& self, const prop::Property& node, size_t depth,
+                       prop::Subtree_Stats& out ) -> void {
+        out.node_count += 1;
+        out.type_counts[static_cast<size_t>( node.get_type() )] += 1;
+        out.height = std::max( out.height, depth );
+        out.bytes += node.approximate_bytes();
+        if( node.get_type() == schema::Property_Value_Type::OBJECT ) {
+            static_cast<const prop::Object_Property&>( node ).for_each_child(
+                [&]( const std::string&, const std::shared_ptr<prop::Property>& child ) {
+                    self( self, *child, depth + 1, out );
+                });
+        }
+        else if( node.get_type() == schema::Property_Value_Type::ARRAY ) {
+            const auto& array = static_cast<const prop::Array_Property&>( node );
+            for( size_t i = 0; i < array.size(); ++i ) {
+                self( self, *array.item_at( i ), depth + 1, out );
+            }
+        }
+    };
+    auto check = [&]() {
+        prop::Subtree_Stats expected;
+        recount( recount, *datastore->get_root(), 0, expected );
+        auto actual = datastore->get_root()->get_subtree_stats();
+        EXPECT_EQ(actual.node_count, expected.node_count);
+        EXPECT_EQ(actual.type_counts, expected.type_counts);
+        EXPECT_EQ(actual.height, expected.height);
+        EXPECT_EQ(actual.bytes, expected.bytes);
+        EXPECT_EQ(datastore->size(), expected.node_count - 1);
+    };
+
+    EXPECT_EQ(datastore->size(), 0u);
+    EXPECT_EQ(datastore->stats().height, 0u);
+
+    ASSERT_TRUE(datastore->insert_property("a.b.c.d", datastore->make_property<prop::Integer_Property>("", 1)));
+    ASSERT_TRUE(datastore->insert_property("a.x", datastore->make_property<prop::String_Property>("", "x")));
+    auto list = datastore->make_property<prop::Array_Property>("");
+    ASSERT_TRUE(list->add_item(datastore->make_property<prop::Double_Property>("", 1.0)));
+    ASSERT_TRUE(datastore->insert_property("a.list", list));
+    check();
+
+    auto stats = datastore->stats();
+    EXPECT_EQ(stats.node_count, 7u);
+    EXPECT_EQ(stats.leaf_count(), 3u);
+    EXPECT_EQ(stats.count(schema::Property_Value_Type::OBJECT), 3u);
+    EXPECT_EQ(stats.count(schema::Property_Value_Type::ARRAY), 1u);
+    EXPECT_EQ(stats.height, 4u);
+
+    // Nested mutation below an attached array bubbles up
+    ASSERT_TRUE(list->add_item(datastore->make_property<prop::Double_Property>("", 2.0)));
+    check();
+
+    // Removing the tallest branch lowers the height
+    ASSERT_TRUE(datastore->remove_property("a.b"));
+    check();
+    EXPECT_EQ(datastore->stats().height, 3u);
+
+    // Replacing a subtree swaps its counts
+    ASSERT_TRUE(datastore->insert_property("a.list", datastore->make_property<prop::Boolean_Property>("", true)));
+    check();
+    EXPECT_EQ(datastore->stats().count(schema::Property_Value_Type::DOUBLE), 0u);
+
+    // Growing a string value is reflected in the byte total
+    const auto before = datastore->stats().bytes;
+    ASSERT_TRUE(datastore->set<std::string>("a.x", std::string(4096, 'x')));
+    EXPECT_GE(datastore->stats().bytes, before + 4096);
+    check();
+    ASSERT_TRUE(datastore->set<std::string>("a.x", "x"));
+    check();
+
+    datastore->clear();
+    check();
+    EXPECT_EQ(datastore->stats().node_count, 0u);
+}
+
+/************************************************/
+/*      Test Snapshot Publishing And Sharing    */
+/************************************************/
+TEST_F( fcs_Datastore, snapshot_publishes_copies )
+{
+    EXPECT_EQ(datastore->get_concurrency(), Concurrency::NONE);
+    EXPECT_EQ(datastore->snapshot(), nullptr);
+
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("app.port", store.make_property<prop::Integer_Property>("", 8080)));
+    ASSERT_TRUE(store.insert_property("app.name", store.make_property<prop::String_Property>("", "demo")));
+    ASSERT_TRUE(store.insert_property("db.host", store.make_property<prop::String_Property>("", "localhost")));
+
+    auto before = store.snapshot();
+    ASSERT_NE(before, nullptr);
+    ASSERT_TRUE(store.set<int64_t>("app.port", 9090));
+    auto after = store.snapshot();
+
+    // The old snapshot is untouched and the new one sees the write
+    EXPECT_GT(after->version(), before->version());
+    EXPECT_EQ(before->get_or<int64_t>("app.port", 0), 8080);
+    EXPECT_EQ(after->get_or<int64_t>("app.port", 0), 9090);
+    EXPECT_EQ(store.get_or<int64_t>("app.port", 0), 9090);
+
+    // Only the path to the changed node was copied
+    EXPECT_NE(before->get_root(), after->get_root());
+    EXPECT_NE(before->view("app").get(), after->view("app").get());
+    EXPECT_EQ(before->view("app.name").get(), after->view("app.name").get());
+    EXPECT_EQ(before->view("db").get(), after->view("db").get());
+
+    // Structural changes and failed writes leave published snapshots alone
+    ASSERT_TRUE(store.remove_property("db"));
+    EXPECT_FALSE(store.set<std::string>("app.port", "oops"));
+    EXPECT_EQ(before->get_or<std::string>("db.host", ""), "localhost");
+    EXPECT_FALSE(store.snapshot()->has_property("db"));
+    EXPECT_EQ(store.snapshot()->size(), store.size());
+    EXPECT_EQ(store.snapshot()->stats().bytes, store.stats().bytes);
+
+    auto value = store.snapshot()->get_scalar_value("app.port");
+    ASSERT_TRUE(value);
+    EXPECT_EQ(std::get<int64_t>(value.value()), 9090);
+
+    // Published nodes are only handed out as const, and outlive later writes
+    auto port = store.read_property("app.port");
+    ASSERT_TRUE(port);
+    static_assert(std::is_const_v<std::remove_reference_t<decltype(*port.value())>>);
+    ASSERT_TRUE(store.set<int64_t>("app.port", 7070));
+    EXPECT_EQ(std::get<int64_t>(port.value()->get_scalar_value().value()), 9090);
+    EXPECT_EQ(std::get<int64_t>(store.read_property("app.port").value()->get_scalar_value().value()), 7070);
+    EXPECT_FALSE(store.read_property("db.host"));
+    EXPECT_EQ(store.read_property("").value()->get_type(), schema::Property_Value_Type::OBJECT);
+
+    auto mutable_port = store.get_property("app.port");
+    ASSERT_FALSE(mutable_port);
+    EXPECT_EQ(mutable_port.error().code(), tmns::error::Error_Code::NOT_SUPPORTED);
+    EXPECT_TRUE(store.has_property("app.port").value());
+    EXPECT_TRUE(datastore->get_property("").has_value());
+
+    // Datastores move but do not copy; clone() is the cheap copy
+    static_assert(!std::is_copy_constructible_v<Datastore>);
+    static_assert(!std::is_copy_assignable_v<Datastore>);
+    static_assert(std::is_move_constructible_v<Datastore>);
+}
+
+/************************************************/
+/*      Test Snapshot Reads Alongside Writes    */
+/************************************************/
+TEST_F( fcs_Datastore, snapshot_concurrent_readers )
+{
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("counter.low", store.make_property<prop::Integer_Property>("", 0)));
+    ASSERT_TRUE(store.insert_property("counter.high", store.make_property<prop::Integer_Property>("", 0)));
+
+    constexpr int64_t WRITES = 2000;
+    std::atomic<bool> done{ false };
+    std::atomic<int>  errors{ 0 };
+
+    std::vector<std::thread> readers;
+    for( int i = 0; i < 4; ++i ) {
+        readers.emplace_back( [&]() {
+            uint64_t last_version = 0;
+            while( !done.load( std::memory_order_acquire ) ) {
+                auto snapshot = store.snapshot();
+                auto low  = snapshot->get_or<int64_t>( "counter.low", -1 );
+                auto high = snapshot->get_or<int64_t>( "counter.high", -1 );
+
+                // The writer bumps high before low, so a snapshot never sees low ahead
+                if( snapshot->version() < last_version || low > high || high - low > 1 ) {
+                    errors.fetch_add( 1 );
+                }
+                last_version = snapshot->version();
+            }
+        } );
+    }
+
+    for( int64_t i = 1; i <= WRITES; ++i ) {
+        ASSERT_TRUE(store.set<int64_t>("counter.high", i));
+        ASSERT_TRUE(store.set<int64_t>("counter.low", i));
+    }
+    done.store( true, std::memory_order_release );
+    for( auto& reader : readers ) {
+        reader.join();
+    }
+
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(store.snapshot()->get_or<int64_t>("counter.low", 0), WRITES);
+}
+
+/************************************************/
+/*      Test Thread-Local Cached Snapshots      */
+/************************************************/
+TEST_F( fcs_Datastore, local_view_refresh )
+{
+    auto empty = datastore->local_view();
+    EXPECT_FALSE(empty);
+    EXPECT_FALSE(empty.refresh());
+
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("app.port", store.make_property<prop::Integer_Property>("", 8080)));
+
+    auto view = store.local_view();
+    ASSERT_TRUE(view);
+    EXPECT_FALSE(view.refresh());
+    EXPECT_EQ(view->get_or<int64_t>("app.port", 0), 8080);
+
+    // The cached snapshot is kept until the next refresh
+    ASSERT_TRUE(store.set<int64_t>("app.port", 9090));
+    EXPECT_EQ(view->get_or<int64_t>("app.port", 0), 8080);
+    EXPECT_TRUE(view.refresh());
+    EXPECT_EQ(view->get_or<int64_t>("app.port", 0), 9090);
+    EXPECT_FALSE(view.refresh());
+    EXPECT_EQ(view.get(), store.snapshot().get());
+
+    // Writes that change nothing do not invalidate views
+    EXPECT_FALSE(store.set<std::string>("app.port", "oops"));
+    EXPECT_FALSE(view.refresh());
+}
+
+/************************************************/
+/*          Test Hot Scalar Properties          */
+/************************************************/
+TEST_F( fcs_Datastore, hot_properties )
+{
+    ASSERT_TRUE(datastore->insert_property("limits.workers", std::make_shared<prop::Integer_Property>("", 4)));
+    ASSERT_TRUE(datastore->insert_property("limits.name", std::make_shared<prop::String_Property>("", "default")));
+
+    auto handle = datastore->hot<int64_t>("limits.workers");
+    ASSERT_TRUE(handle);
+    EXPECT_EQ(handle.value().load(), 4);
+    EXPECT_EQ(datastore->hot<double>("limits.workers").error().code(), tmns::error::Error_Code::TYPE_MISMATCH);
+    EXPECT_EQ(datastore->hot<bool>("limits.missing").error().code(), tmns::error::Error_Code::NOT_FOUND);
+
+    // Writes through the datastore reach the handle once they succeed
+    ASSERT_TRUE(datastore->set<int64_t>("limits.workers", 8));
+    EXPECT_EQ(handle.value().load(), 8);
+    ASSERT_TRUE(datastore->set_scalar_value("limits.workers", Value( int64_t{ 16 } )));
+    EXPECT_EQ(handle.value().load(), 16);
+    EXPECT_EQ(datastore->hot<int64_t>("limits.workers").value().load(), 16);
+    EXPECT_EQ(handle.value().changes(), 2u);
+
+    // The property stays an ordinary, versioned and hashed property
+    const auto version = datastore->get_version("limits.workers").value();
+    const auto hash    = datastore->content_hash();
+    ASSERT_TRUE(datastore->set<int64_t>("limits.workers", 32));
+    EXPECT_GT(datastore->get_version("limits.workers").value(), version);
+    EXPECT_NE(datastore->content_hash(), hash);
+
+    // Subtree replacement and removal reach the handle; a removed property keeps its last value
+    auto limits = std::make_shared<prop::Object_Property>("");
+    ASSERT_TRUE(limits->add_property(std::make_shared<prop::Integer_Property>("workers", 2)));
+    ASSERT_TRUE(datastore->insert_property("limits", limits));
+    EXPECT_EQ(handle.value().load(), 2);
+    ASSERT_TRUE(datastore->remove_property("limits"));
+    EXPECT_EQ(handle.value().load(), 2);
+
+    // An empty handle loads a default value
+    EXPECT_EQ(prop::Hot_Handle<int64_t>().load(), 0);
+
+    // Snapshot mode: snapshots stay immutable and the handle follows the latest one
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("log.verbose", store.make_property<prop::Boolean_Property>("", false)));
+    auto verbose = store.hot<bool>("log.verbose").value();
+    auto before  = store.snapshot();
+    ASSERT_TRUE(store.set<bool>("log.verbose", true));
+    EXPECT_TRUE(verbose.load());
+    EXPECT_TRUE(store.snapshot()->get_or<bool>("log.verbose", false));
+    EXPECT_FALSE(before->get_or<bool>("log.verbose", true));
+}
+
+/************************************************/
+/*        Test Watched Config Value Handles     */
+/************************************************/
+TEST_F( fcs_Datastore, watch_config_values )
+{
+    ASSERT_TRUE(datastore->insert_property("server.workers", std::make_shared<prop::Integer_Property>("", 4)));
+    ASSERT_TRUE(datastore->insert_property("server.host", std::make_shared<prop::String_Property>("", "localhost")));
+
+    auto workers = datastore->watch<int64_t>("server.workers");
+    auto host    = datastore->watch<std::string>("server.host");
+    ASSERT_TRUE(workers);
+    ASSERT_TRUE(host);
+    EXPECT_EQ(workers.value().get(), 4);
+    EXPECT_EQ(host.value().get(), "localhost");
+    EXPECT_EQ(datastore->watch<std::string>("server.workers").error().code(), tmns::error::Error_Code::TYPE_MISMATCH);
+    EXPECT_EQ(datastore->watch<int64_t>("server.missing").error().code(), tmns::error::Error_Code::NOT_FOUND);
+
+    // Every write path updates the handles
+    ASSERT_TRUE(datastore->set<int64_t>("server.workers", 8));
+    ASSERT_TRUE(datastore->set_scalar_value("server.host", Value(std::string("example.com"))));
+    EXPECT_EQ(workers.value().get(), 8);
+    EXPECT_EQ(*host.value().share(), "example.com");
+    ASSERT_TRUE(datastore->set_property("server.host", std::string("example.org")));
+    EXPECT_EQ(host.value().get(), "example.org");
+    EXPECT_EQ(host.value().changes(), 2u);
+
+    // Watching leaves the property versioned and hashed
+    const auto version = datastore->get_version("server.workers").value();
+    const auto hash    = datastore->content_hash();
+    ASSERT_TRUE(datastore->set<int64_t>("server.workers", 12));
+    EXPECT_GT(datastore->get_version("server.workers").value(), version);
+    EXPECT_NE(datastore->content_hash(), hash);
+
+    // Handles are only updated once a write commits
+    auto transaction = datastore->transaction();
+    transaction.set<std::string>("server.host", "staged.example.com")
+               .set<int64_t>("server.missing", 1);
+    EXPECT_FALSE(transaction.commit());
+    EXPECT_EQ(host.value().get(), "example.org");
+    EXPECT_EQ(datastore->get_or<std::string>("server.host", ""), "example.org");
+    EXPECT_EQ(Config_Value<std::string>().get(), "");
+
+    // Snapshot mode: writes copy the property, and the copy keeps feeding the handle
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("log.file", store.make_property<prop::String_Property>("", "out.log")));
+    auto file = store.watch<std::string>("log.file").value();
+    auto held = file.share();
+    ASSERT_TRUE(store.set<std::string>("log.file", "err.log"));
+    EXPECT_EQ(file.get(), "err.log");
+    EXPECT_EQ(*held, "out.log");
+}
+
+/************************************************/
+/*          Test Batched Transactions           */
+/************************************************/
+TEST_F( fcs_Datastore, transactions_apply_atomically )
+{
+    ASSERT_TRUE(datastore->insert_property("app.server.port", std::make_shared<prop::Integer_Property>("", 80)));
+    ASSERT_TRUE(datastore->insert_property("app.server.host", std::make_shared<prop::String_Property>("", "localhost")));
+
+    // A failed write leaves the tree as it was
+    auto failing = datastore->transaction();
+    failing.set<int64_t>("app.server.port", 8080)
+           .set<int64_t>("app.server.missing", 1);
+    EXPECT_EQ(failing.size(), 2u);
+    EXPECT_EQ(failing.commit().error().code(), tmns::error::Error_Code::NOT_FOUND);
+    EXPECT_EQ(failing.size(), 0u);
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 80);
+
+    // A failed validation rolls back every staged write
+    auto schema = schema::Builder(schema::Property_Value_Type::INTEGER)
+        .range(int64_t{1}, int64_t{1024})
+        .build();
+    ASSERT_TRUE(datastore->set_schema("app.server.port", *schema));
+    auto host    = datastore->watch<std::string>("app.server.host").value();
+    auto port    = datastore->hot<int64_t>("app.server.port").value();
+    auto invalid = datastore->transaction();
+    invalid.set<std::string>("app.server.host", "example.com")
+           .set<int64_t>("app.server.port", 8080);
+    EXPECT_FALSE(invalid.commit());
+    EXPECT_EQ(datastore->get_or<std::string>("app.server.host", ""), "localhost");
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 80);
+    EXPECT_EQ(host.get(), "localhost");
+    EXPECT_EQ(port.load(), 80);
+
+    auto valid = datastore->transaction();
+    valid.set<std::string>("app.server.host", "example.com")
+         .set<int64_t>("app.server.port", 443)
+         .insert_property("app.server.tls", std::make_shared<prop::Boolean_Property>("", true))
+         .remove_property("app.server.host");
+    ASSERT_TRUE(valid.commit());
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 443);
+    EXPECT_TRUE(datastore->get_or<bool>("app.server.tls", false));
+    EXPECT_FALSE(datastore->has_property("app.server.host").value());
+
+    // Snapshot mode publishes one version, and listeners hear each path once
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("app.server.port", store.make_property<prop::Integer_Property>("", 80)));
+    ASSERT_TRUE(store.insert_property("app.server.workers", store.make_property<prop::Integer_Property>("", 4)));
+    std::vector<std::string> changed;
+    ASSERT_TRUE(store.add_change_listener("app.*", [&]( std::string_view path, const prop::Property* ) {
+        changed.emplace_back( path );
+    }));
+
+    auto before = store.snapshot();
+    auto batch  = store.transaction();
+    batch.set<int64_t>("app.server.port", 8080)
+         .set<int64_t>("app.server.workers", 8)
+         .set<int64_t>("app.server.port", 8081);
+    ASSERT_TRUE(batch.commit());
+    auto after = store.snapshot();
+    EXPECT_EQ(after->version(), before->version() + 1);
+    EXPECT_EQ(after->get_or<int64_t>("app.server.port", 0), 8081);
+    EXPECT_EQ(after->get_or<int64_t>("app.server.workers", 0), 8);
+    EXPECT_EQ(before->get_or<int64_t>("app.server.port", 0), 80);
+    EXPECT_EQ(changed, (std::vector<std::string>{ "app.server.workers", "app.server.port" }));
+
+    // Hot handles and published snapshots never see a rejected batch
+    changed.clear();
+    auto workers  = store.hot<int64_t>("app.server.workers").value();
+    auto rejected = store.transaction();
+    rejected.set<int64_t>("app.server.workers", 16)
+            .set<std::string>("app.server.port", "http");
+    EXPECT_EQ(rejected.commit().error().code(), tmns::error::Error_Code::TYPE_MISMATCH);
+    EXPECT_EQ(store.snapshot()->version(), after->version());
+    EXPECT_EQ(store.get_or<int64_t>("app.server.workers", 0), 8);
+    EXPECT_EQ(workers.load(), 8);
+    EXPECT_EQ(after->get_or<int64_t>("app.server.workers", 0), 8);
+    EXPECT_TRUE(changed.empty());
+}
+
+/************************************************/
+/*      Test Versions and Compare-And-Set       */
+/************************************************/
+TEST_F( fcs_Datastore, compare_and_set_versions )
+{
+    ASSERT_TRUE(datastore->insert_property("app.server.port", std::make_shared<prop::Integer_Property>("", 80)));
+    ASSERT_TRUE(datastore->insert_property("app.server.workers", std::make_shared<prop::Integer_Property>("", 4)));
+
+    // Every write moves the version forward
+    auto version = datastore->get_version("app.server.port").value();
+    ASSERT_TRUE(datastore->set<int64_t>("app.server.port", 81));
+    auto updated = datastore->get_version("app.server.port").value();
+    EXPECT_GT(updated, version);
+    EXPECT_EQ(datastore->get_version("app.server.missing").error().code(), tmns::error::Error_Code::NOT_FOUND);
+
+    // A stale version loses
+    EXPECT_FALSE(datastore->compare_and_set("app.server.port", version, Value(int64_t{90})).value());
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 81);
+    EXPECT_TRUE(datastore->compare_and_set("app.server.port", updated, Value(int64_t{90})).value());
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 90);
+    EXPECT_EQ(datastore->compare_and_set("app.server.port", 0, Value(std::string("http"))).error().code(),
+              tmns::error::Error_Code::TYPE_MISMATCH);
+
+    // Bulk writes apply together or not at all
+    const auto port    = datastore->get_version("app.server.port").value();
+    const auto workers = datastore->get_version("app.server.workers").value();
+    EXPECT_FALSE(datastore->compare_and_set({ { "app.server.port", port, Value(int64_t{443}) },
+                                              { "app.server.workers", version, Value(int64_t{8}) } }).value());
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 90);
+    EXPECT_TRUE(datastore->compare_and_set({ { "app.server.port", port, Value(int64_t{443}) },
+                                             { "app.server.workers", workers, Value(int64_t{8}) } }).value());
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 443);
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.workers", 0), 8);
+
+    // Bulk writes are validated, and a rejected value rolls back the others
+    auto schema = schema::Builder(schema::Property_Value_Type::INTEGER)
+        .range(int64_t{1}, int64_t{64})
+        .build();
+    ASSERT_TRUE(datastore->set_schema("app.server.workers", *schema));
+    auto rejected = datastore->compare_and_set({ { "app.server.port", datastore->get_version("app.server.port").value(), Value(int64_t{8443}) },
+                                                 { "app.server.workers", datastore->get_version("app.server.workers").value(), Value(int64_t{128}) } });
+    EXPECT_FALSE(rejected);
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 443);
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.workers", 0), 8);
+
+    // Hot handles are read-only, so every change to a hot property moves its version
+    auto hot_port = datastore->hot<int64_t>("app.server.port").value();
+    const auto hot_version = datastore->get_version("app.server.port").value();
+    ASSERT_TRUE(datastore->set<int64_t>("app.server.port", 444));
+    EXPECT_FALSE(datastore->compare_and_set("app.server.port", hot_version, Value(int64_t{445})).value());
+    EXPECT_EQ(hot_port.load(), 444);
+
+    // Snapshot mode: copies keep the version, so readers can CAS against what they read
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("app.server.port", store.make_property<prop::Integer_Property>("", 80)));
+    auto before = store.snapshot();
+    ASSERT_TRUE(store.insert_property("app.server.host", store.make_property<prop::String_Property>("", "localhost")));
+    const auto read_at = before->get_version("app.server.port").value();
+    EXPECT_EQ(store.get_version("app.server.port").value(), read_at);
+    EXPECT_TRUE(store.compare_and_set("app.server.port", read_at, Value(int64_t{8080})).value());
+    EXPECT_NE(store.snapshot()->get_version("app.server.port").value(), read_at);
+    EXPECT_EQ(before->get_version("app.server.port").value(), read_at);
+
+    // Racing writers: each increment retries until its CAS wins
+    constexpr int THREADS = 4;
+    constexpr int INCREMENTS = 200;
+    std::vector<std::thread> writers;
+    for( int t = 0; t < THREADS; ++t ) {
+        writers.emplace_back( [&]() {
+            for( int i = 0; i < INCREMENTS; ++i ) {
+                while( true ) {
+                    auto snapshot = store.snapshot();
+                    auto current  = snapshot->get<int64_t>("app.server.port").value();
+                    auto at       = snapshot->get_version("app.server.port").value();
+                    if( store.compare_and_set("app.server.port", at, Value(current + 1)).value() ) {
+                        break;
+                    }
+                }
+            }
+        } );
+    }
+    for( auto& writer : writers ) {
+        writer.join();
+    }
+    EXPECT_EQ(store.get_or<int64_t>("app.server.port", 0), 8080 + THREADS * INCREMENTS);
+}
+
+/************************************************/
+/*        Test Structurally Shared Clones       */
+/************************************************/
+TEST_F( fcs_Datastore, clone_shares_structure )
+{
+    ASSERT_TRUE(datastore->insert_property("app.server.port", std::make_shared<prop::Integer_Property>("", 80)));
+    ASSERT_TRUE(datastore->insert_property("app.server.workers", std::make_shared<prop::Integer_Property>("", 4)));
+    ASSERT_TRUE(datastore->insert_property("app.database.host", std::make_shared<prop::String_Property>("", "localhost")));
+    auto workers = datastore->hot<int64_t>("app.server.workers").value();
+    auto host    = datastore->watch<std::string>("app.database.host").value();
+
+    // Nothing is copied until one side writes
+    auto copy = datastore->clone();
+    EXPECT_EQ(copy.size(), datastore->size());
+    EXPECT_EQ(copy.get_property("app").value(), datastore->get_property("app").value());
+
+    // Writes copy only the path they touch
+    ASSERT_TRUE(copy.set<int64_t>("app.server.port", 8080));
+    EXPECT_EQ(copy.get_or<int64_t>("app.server.port", 0), 8080);
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 80);
+    EXPECT_NE(copy.get_property("app.server").value(), datastore->get_property("app.server").value());
+    EXPECT_EQ(copy.get_property("app.database").value(), datastore->get_property("app.database").value());
+
+    ASSERT_TRUE(datastore->set<int64_t>("app.server.port", 81));
+    ASSERT_TRUE(copy.insert_property("app.server.tls", std::make_shared<prop::Boolean_Property>("", true)));
+    ASSERT_TRUE(copy.remove_property("app.database"));
+    EXPECT_EQ(copy.get_or<int64_t>("app.server.port", 0), 8080);
+    EXPECT_FALSE(datastore->has_property("app.server.tls").value());
+    EXPECT_EQ(datastore->get_or<std::string>("app.database.host", ""), "localhost");
+    EXPECT_EQ(copy.size(), 5u);
+    EXPECT_EQ(datastore->size(), 6u);
+
+    // The clone's writes do not reach the original's handles
+    ASSERT_TRUE(copy.set<int64_t>("app.server.workers", 16));
+    EXPECT_EQ(workers.load(), 4);
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.workers", 0), 4);
+    auto other = datastore->clone();
+    ASSERT_TRUE(other.set<std::string>("app.database.host", "example.com"));
+    EXPECT_EQ(host.get(), "localhost");
+    ASSERT_TRUE(datastore->set<std::string>("app.database.host", "db.internal"));
+    EXPECT_EQ(host.get(), "db.internal");
+    EXPECT_EQ(other.get_or<std::string>("app.database.host", ""), "example.com");
+
+    // Nor do the original's writes reach the clone's handles
+    auto branch_workers = other.hot<int64_t>("app.server.workers").value();
+    auto branch_host    = other.watch<std::string>("app.database.host").value();
+    ASSERT_TRUE(datastore->set<int64_t>("app.server.workers", 32));
+    ASSERT_TRUE(datastore->set<std::string>("app.database.host", "db.example.com"));
+    EXPECT_EQ(workers.load(), 32);
+    EXPECT_EQ(branch_workers.load(), 4);
+    EXPECT_EQ(other.get_or<int64_t>("app.server.workers", 0), 4);
+    EXPECT_EQ(branch_host.get(), "example.com");
+
+    // The original keeps copying on write, so nodes fetched before a write keep the old values
+    auto before = datastore->get_property("app.server.port").value();
+    ASSERT_TRUE(datastore->set<int64_t>("app.server.port", 82));
+    EXPECT_EQ(before->get_scalar_value().value(), Value(int64_t{81}));
+    EXPECT_EQ(datastore->get_or<int64_t>("app.server.port", 0), 82);
+
+    // Snapshot mode clones the latest snapshot
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("app.server.port", store.make_property<prop::Integer_Property>("", 80)));
+    auto branch = store.clone();
+    EXPECT_EQ(branch.get_concurrency(), Concurrency::SNAPSHOT);
+    EXPECT_EQ(branch.snapshot()->get_root(), store.snapshot()->get_root());
+    ASSERT_TRUE(branch.set<int64_t>("app.server.port", 8080));
+    EXPECT_EQ(branch.snapshot()->get_or<int64_t>("app.server.port", 0), 8080);
+    EXPECT_EQ(store.snapshot()->get_or<int64_t>("app.server.port", 0), 80);
+}
+
+/************************************************/
+/*      Test Version History and Rollback       */
+/************************************************/
+TEST_F( fcs_Datastore, history_checkout_rollback )
+{
+    EXPECT_EQ(datastore->enable_history().error().code(), tmns::error::Error_Code::NOT_SUPPORTED);
+    EXPECT_EQ(datastore->rollback().error().code(), tmns::error::Error_Code::NOT_SUPPORTED);
+
+    Datastore store( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(store.insert_property("app.server.port", store.make_property<prop::Integer_Property>("", 80)));
+    ASSERT_TRUE(store.insert_property("app.database.host", store.make_property<prop::String_Property>("", "localhost")));
+    ASSERT_TRUE(store.enable_history( 4 ));
+    const auto base = store.version();
+    EXPECT_EQ(store.history().size(), 1u);
+
+    ASSERT_TRUE(store.set<int64_t>("app.server.port", 8080));
+    ASSERT_TRUE(store.insert_property("app.server.tls", store.make_property<prop::Boolean_Property>("", true)));
+    EXPECT_EQ(store.version(), base + 2);
+    auto port = store.hot<int64_t>("app.server.port").value();
+
+    std::vector<std::string> changed;
+    ASSERT_TRUE(store.add_change_listener("**", [&]( std::string_view path, const prop::Property* ) {
+        changed.emplace_back( path );
+    }));
+
+    // Only the paths that differ are notified; app.database is shared and skipped
+    ASSERT_TRUE(store.checkout( base ));
+    EXPECT_EQ(store.version(), base + 3);
+    EXPECT_EQ(store.get_or<int64_t>("app.server.port", 0), 80);
+    EXPECT_FALSE(store.has_property("app.server.tls").value());
+    EXPECT_EQ(store.snapshot()->get_root(), store.history().front()->get_root());
+    std::sort( changed.begin(), changed.end() );
+    EXPECT_EQ(changed, (std::vector<std::string>{ "app.server.port", "app.server.tls" }));
+    EXPECT_EQ(port.load(), 80);
+    EXPECT_EQ(port.changes(), 1u);
+
+    // Rolling back one step undoes the checkout
+    ASSERT_TRUE(store.rollback());
+    EXPECT_EQ(store.get_or<int64_t>("app.server.port", 0), 8080);
+    EXPECT_TRUE(store.get_or<bool>("app.server.tls", false));
+    EXPECT_EQ(port.load(), 8080);
+    EXPECT_EQ(port.changes(), 2u);
+    auto host = store.watch<std::string>("app.database.host").value();
+    ASSERT_TRUE(store.set<std::string>("app.database.host", "db.internal"));
+    EXPECT_EQ(host.get(), "db.internal");
+
+    // The history is bounded
+    EXPECT_EQ(store.history().size(), 4u);
+    EXPECT_EQ(store.checkout( base ).error().code(), tmns::error::Error_Code::NOT_FOUND);
+    EXPECT_EQ(store.rollback( 4 ).error().code(), tmns::error::Error_Code::OUT_OF_BOUNDS);
+    ASSERT_TRUE(store.rollback( 2 ));
+    EXPECT_EQ(store.get_or<int64_t>("app.server.port", 0), 80);
+    EXPECT_FALSE(store.has_property("app.server.tls").value());
+    EXPECT_EQ(store.get_or<std::string>("app.database.host", ""), "localhost");
+    EXPECT_EQ(host.get(), "localhost");
+    EXPECT_EQ(port.load(), 80);
+}
+
+/************************************************/
+/*          Test Datastore Content Hash         */
+/************************************************/
+TEST_F( fcs_Datastore, content_hash_compares_trees )
+{
+    Datastore other( Concurrency::SNAPSHOT );
+    EXPECT_EQ(datastore->content_hash(), other.content_hash());
+
+    ASSERT_TRUE(datastore->insert_property("app.server.port", std::make_shared<prop::Integer_Property>("", 80)));
+    ASSERT_TRUE(datastore->insert_property("app.server.host", std::make_shared<prop::String_Property>("", "localhost")));
+    ASSERT_TRUE(other.insert_property("app.server.host", other.make_property<prop::String_Property>("", "localhost")));
+    ASSERT_TRUE(other.insert_property("app.server.port", other.make_property<prop::Integer_Property>("", 8080)));
+    EXPECT_NE(datastore->content_hash(), other.content_hash());
+
+    auto before = other.snapshot();
+    auto port = other.hot<int64_t>("app.server.port").value();
+    ASSERT_TRUE(other.set<int64_t>("app.server.port", 80));
+    EXPECT_EQ(port.load(), 80);
+    EXPECT_EQ(datastore->content_hash(), other.content_hash());
+    EXPECT_EQ(other.snapshot()->content_hash(), other.content_hash());
+    EXPECT_NE(before->content_hash(), other.content_hash());
+
+    // Clones start equal and diverge on write
+    auto copy = datastore->clone();
+    EXPECT_EQ(copy.content_hash(), datastore->content_hash());
+    ASSERT_TRUE(copy.remove_property("app.server.host"));
+    EXPECT_NE(copy.content_hash(), datastore->content_hash());
+}
+
+/************************************************/
+/*             Test Datastore Diff              */
+/************************************************/
+TEST_F( fcs_Datastore, diff_lists_changed_paths )
+{
+    ASSERT_TRUE(datastore->insert_property("app.server.port", std::make_shared<prop::Integer_Property>("", 80)));
+    ASSERT_TRUE(datastore->insert_property("app.server.host", std::make_shared<prop::String_Property>("", "localhost")));
+    ASSERT_TRUE(datastore->insert_property("app.database.host", std::make_shared<prop::String_Property>("", "db")));
+    ASSERT_TRUE(datastore->insert_property("app.logging.level", std::make_shared<prop::String_Property>("", "info")));
+    EXPECT_TRUE(diff( *datastore, *datastore ).empty());
+
+    auto next = datastore->clone();
+    ASSERT_TRUE(next.set<int64_t>("app.server.port", 8080));
+    ASSERT_TRUE(next.remove_property("app.logging"));
+    ASSERT_TRUE(next.insert_property("app.server.tls", next.make_property<prop::Boolean_Property>("", true)));
+
+    const auto changes = diff( *datastore, next );
+    ASSERT_EQ(changes.size(), 3u);
+    EXPECT_EQ(changes[0].kind, Change_Kind::REMOVED);
+    EXPECT_EQ(changes[0].path, "app.logging");
+    EXPECT_FALSE(changes[0].old_value.has_value());
+    EXPECT_EQ(changes[1].kind, Change_Kind::MODIFIED);
+    EXPECT_EQ(changes[1].path, "app.server.port");
+    EXPECT_EQ(changes[1].old_value, Value( int64_t{ 80 } ));
+    EXPECT_EQ(changes[1].new_value, Value( int64_t{ 8080 } ));
+    EXPECT_EQ(changes[2].kind, Change_Kind::ADDED);
+    EXPECT_EQ(changes[2].path, "app.server.tls");
+    EXPECT_FALSE(changes[2].old_value.has_value());
+    EXPECT_EQ(changes[2].new_value, Value( true ));
+
+    // The visitor sees the tops of changed subtrees only
+    std::vector<std::string> visited;
+    diff_trees( *datastore->get_root(), *next.get_root(), [&]( Change_Kind, std::string_view path, auto, auto ) {
+        visited.emplace_back( path );
+    });
+    EXPECT_EQ(visited.size(), 3u);
+
+    // Equal trees built separately compare by hash; snapshots compare the same way
+    Datastore rebuilt( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(rebuilt.insert_property("app.logging.level", rebuilt.make_property<prop::String_Property>("", "info")));
+    ASSERT_TRUE(rebuilt.insert_property("app.database.host", rebuilt.make_property<prop::String_Property>("", "db")));
+    ASSERT_TRUE(rebuilt.insert_property("app.server.host", rebuilt.make_property<prop::String_Property>("", "localhost")));
+    ASSERT_TRUE(rebuilt.insert_property("app.server.port", rebuilt.make_property<prop::Integer_Property>("", 80)));
+    EXPECT_TRUE(diff( *datastore, rebuilt ).empty());
+
+    // Writes to hot and watched properties move the hash like any other write
+    auto port = rebuilt.hot<int64_t>("app.server.port").value();
+    auto host = rebuilt.watch<std::string>("app.database.host").value();
+    ASSERT_TRUE(rebuilt.set<int64_t>("app.server.port", 7));
+    ASSERT_TRUE(rebuilt.set<std::string>("app.database.host", "db.internal"));
+    const auto live_changes = diff( *datastore, rebuilt );
+    ASSERT_EQ(live_changes.size(), 2u);
+    EXPECT_EQ(live_changes[0].path, "app.database.host");
+    EXPECT_EQ(live_changes[1].path, "app.server.port");
+    EXPECT_EQ(live_changes[1].new_value, Value( int64_t{ 7 } ));
+    EXPECT_EQ(port.load(), 7);
+    EXPECT_EQ(host.get(), "db.internal");
+
+    auto before = rebuilt.snapshot();
+    ASSERT_TRUE(rebuilt.set<std::string>("app.server.host", "example.com"));
+    const auto snapshot_changes = diff( *before, *rebuilt.snapshot() );
+    ASSERT_EQ(snapshot_changes.size(), 1u);
+    EXPECT_EQ(snapshot_changes[0].path, "app.server.host");
+    EXPECT_EQ(snapshot_changes[0].new_value, Value( std::string( "example.com" ) ));
+}
@@ -0,0 +1,130 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_epoch_manager.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/epoch_manager.hpp>
+
+using namespace tmns::fcs;
+
+/***********************************/
+/*      Retire Waits For Readers   */
+/***********************************/
+TEST( fcs_Epoch_Manager, retire_waits_for_readers )
+{
+    auto& epochs = Epoch_Manager::instance();
+    epochs.reclaim();
+
+    auto object = std::make_shared<int>( 7 );
+    std::weak_ptr<int> watch = object;
+    {
+        auto outer = epochs.pin();
+        auto inner = epochs.pin();
+        EXPECT_TRUE(outer);
+
+        epochs.retire( std::move( object ) );
+        epochs.reclaim();
+        EXPECT_FALSE(watch.expired());
+
+        // Leaving the inner pin keeps the thread pinned
+        inner = Epoch_Manager::Guard();
+        epochs.reclaim();
+        EXPECT_FALSE(watch.expired());
+    }
+    epochs.reclaim();
+    EXPECT_TRUE(watch.expired());
+
+    // Pinning after the retire does not delay the release
+    auto late = std::make_shared<int>( 8 );
+    std::weak_ptr<int> late_watch = late;
+    epochs.retire( std::move( late ) );
+    auto pin = epochs.pin();
+    epochs.reclaim();
+    EXPECT_TRUE(late_watch.expired());
+}
+
+/***********************************/
+/*      Pinned Thread Blocks Free  */
+/***********************************/
+TEST( fcs_Epoch_Manager, other_thread_pins )
+{
+    auto& epochs = Epoch_Manager::instance();
+
+    std::atomic<int> stage{ 0 };
+    std::thread reader( [&]() {
+        auto pin = epochs.pin();
+        stage = 1;
+        while( stage.load() != 2 ) {
+            std::this_thread::yield();
+        }
+    });
+    while( stage.load() != 1 ) {
+        std::this_thread::yield();
+    }
+
+    auto object = std::make_shared<int>( 1 );
+    std::weak_ptr<int> watch = object;
+    epochs.retire( std::move( object ) );
+    epochs.reclaim();
+    EXPECT_FALSE(watch.expired());
+
+    stage = 2;
+    reader.join();
+    epochs.reclaim();
+    EXPECT_TRUE(watch.expired());
+
+    // Records of exited threads are reused rather than growing the reader list
+    for( int i = 0; i < 8; ++i ) {
+        std::thread( [&]() { auto pin = epochs.pin(); } ).join();
+    }
+    epochs.reclaim();
+    EXPECT_EQ(epochs.pending(), 0u);
+}
+
+/***********************************/
+/*      Datastore Read Guards      */
+/***********************************/
+TEST( fcs_Epoch_Manager, datastore_read_guard )
+{
+    Datastore datastore( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(datastore.insert_property("app.port", datastore.make_property<prop::Integer_Property>("", 8080)));
+
+    std::weak_ptr<const Snapshot> first;
+    {
+        auto guard = datastore.read();
+        ASSERT_TRUE(guard);
+        first = datastore.snapshot();
+        EXPECT_EQ(guard.get(), first.lock().get());
+
+        // A write publishes a new version; the guarded one stays readable
+        ASSERT_TRUE(datastore.set<int64_t>("app.port", 9090));
+        EXPECT_EQ(guard->get_or<int64_t>("app.port", 0), 8080);
+        EXPECT_FALSE(first.expired());
+    }
+
+    // The next publication releases it
+    ASSERT_TRUE(datastore.set<int64_t>("app.port", 9191));
+    EXPECT_TRUE(first.expired());
+    EXPECT_EQ(datastore.read()->get_or<int64_t>("app.port", 0), 9191);
+
+    EXPECT_FALSE(Datastore().read());
+}
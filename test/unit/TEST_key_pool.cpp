@@ -0,0 +1,123 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_key_pool.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/prop/key_pool.hpp>
+#include <terminus/fcs/prop/typed_property.hpp>
+
+using namespace tmns::fcs;
+
+/***********************************/
+/*      Key Pool Tests             */
+/***********************************/
+TEST( fcs_Key_Pool, intern_find_str )
+{
+    auto& pool = prop::Key_Pool::instance();
+
+    auto atom = pool.intern("key_pool_test_alpha").value();
+    EXPECT_EQ(pool.intern("key_pool_test_alpha").value(), atom);
+    EXPECT_EQ(pool.str(atom), "key_pool_test_alpha");
+    ASSERT_TRUE(pool.find("key_pool_test_alpha"));
+    EXPECT_EQ(*pool.find("key_pool_test_alpha"), atom);
+    EXPECT_FALSE(pool.find("key_pool_test_never_interned"));
+
+    // The empty key is always atom zero
+    EXPECT_EQ(pool.intern("").value(), 0u);
+    EXPECT_GT(pool.bytes(), 0u);
+
+    // Only new keys grow the pool
+    const auto bytes = pool.bytes();
+    ASSERT_TRUE(pool.intern("key_pool_test_bytes_" + std::string( 64, 'x' )));
+    EXPECT_GT(pool.bytes(), bytes);
+    const auto grown = pool.bytes();
+    ASSERT_TRUE(pool.intern("key_pool_test_bytes_" + std::string( 64, 'x' )));
+    EXPECT_EQ(pool.bytes(), grown);
+}
+
+/***********************************/
+/*      Shared Key Atoms           */
+/***********************************/
+TEST( fcs_Key_Pool, properties_share_atoms )
+{
+    prop::Integer_Property first("key_pool_shared", 1);
+    prop::Integer_Property second("key_pool_shared", 2);
+    EXPECT_EQ(first.get_key_atom(), second.get_key_atom());
+    EXPECT_EQ(&first.get_key(), &second.get_key());
+
+    ASSERT_TRUE(second.set_key("key_pool_renamed"));
+    EXPECT_NE(first.get_key_atom(), second.get_key_atom());
+    EXPECT_EQ(second.get_key(), "key_pool_renamed");
+
+    // A handle compiled before the key exists resolves once it is created
+    Datastore datastore;
+    auto handle = datastore.compile_path("key_pool.late_child");
+    EXPECT_FALSE(datastore.get_property(handle));
+    ASSERT_TRUE(datastore.insert_property("key_pool.late_child", std::make_shared<prop::Integer_Property>("", 5)));
+    ASSERT_TRUE(datastore.get_property(handle));
+}
+
+/***********************************/
+/*      Concurrent Interning       */
+/***********************************/
+TEST( fcs_Key_Pool, concurrent_intern_and_find )
+{
+    auto& pool = prop::Key_Pool::instance();
+    const int KEYS = 5000;
+
+    std::atomic<bool> done{ false };
+    std::atomic<int>  mismatches{ 0 };
+
+    // Readers translate already-interned keys while the writers grow the table
+    auto stable = pool.intern("key_pool_stable").value();
+    std::thread reader( [&]() {
+        while( !done.load() ) {
+            auto found = pool.find("key_pool_stable");
+            if( !found || *found != stable || pool.str(stable) != "key_pool_stable" ) {
+                ++mismatches;
+            }
+        }
+    });
+
+    std::vector<std::vector<prop::Key_Atom>> results( 4 );
+    std::vector<std::thread> writers;
+    for( size_t t = 0; t < results.size(); ++t ) {
+        writers.emplace_back( [&, t]() {
+            for( int i = 0; i < KEYS; ++i ) {
+                results[t].push_back( pool.intern( "key_pool_concurrent_" + std::to_string( i ) ).value() );
+            }
+        });
+    }
+    for( auto& writer : writers ) {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(mismatches.load(), 0);
+    for( size_t t = 1; t < results.size(); ++t ) {
+        EXPECT_EQ(results[t], results[0]);
+    }
+    for( int i = 0; i < KEYS; ++i ) {
+        EXPECT_EQ(pool.str(results[0][static_cast<size_t>(i)]), "key_pool_concurrent_" + std::to_string(i));
+    }
+}
@@ -0,0 +1,81 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_layered_datastore.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <memory>
+#include <string>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/layered_datastore.hpp>
+
+using namespace tmns::fcs;
+
+/***********************************/
+/*        Top-Down Resolution      */
+/***********************************/
+TEST( fcs_Layered_Datastore, resolves_top_down )
+{
+    Datastore defaults;
+    ASSERT_TRUE(defaults.insert_property("app.server.port", std::make_shared<prop::Integer_Property>("", 80)));
+    ASSERT_TRUE(defaults.insert_property("app.server.host", std::make_shared<prop::String_Property>("", "localhost")));
+    ASSERT_TRUE(defaults.insert_property("app.logging.level", std::make_shared<prop::String_Property>("", "info")));
+
+    Datastore file( Concurrency::SNAPSHOT );
+    ASSERT_TRUE(file.insert_property("app.server.port", file.make_property<prop::Integer_Property>("", 8080)));
+
+    Layered_Datastore config;
+    EXPECT_EQ(config.pop_layer().error().code(), tmns::error::Error_Code::NOT_FOUND);
+    ASSERT_TRUE(config.push_layer("defaults", std::move( defaults )));
+    ASSERT_TRUE(config.push_layer("file", file.snapshot()));
+    EXPECT_EQ(config.push_layer("file", file.snapshot()).error().code(), tmns::error::Error_Code::INVALID_INPUT);
+    EXPECT_EQ(config.push_layer("cli", nullptr).error().code(), tmns::error::Error_Code::INVALID_INPUT);
+    EXPECT_EQ(config.layer_names(), (std::vector<std::string>{ "defaults", "file" }));
+
+    // Each path comes from the topmost layer that has it
+    EXPECT_EQ(config.get_or<int64_t>("app.server.port", 0), 8080);
+    EXPECT_EQ(config.get<std::string>("app.server.host").value(), "localhost");
+    EXPECT_EQ(config.get_source("app.server.port").value(), "file");
+    EXPECT_EQ(config.get_source("app.logging.level").value(), "defaults");
+    EXPECT_EQ(config.get_scalar_value("app.server.port").value(), Value( int64_t{ 8080 } ));
+    EXPECT_EQ(config.get<int64_t>("app.server.host").error().code(), tmns::error::Error_Code::TYPE_MISMATCH);
+    EXPECT_EQ(config.get<int64_t>("app.server.tls").error().code(), tmns::error::Error_Code::NOT_FOUND);
+    EXPECT_FALSE(config.has_property("app.server.tls"));
+
+    // A runtime override shadows the lower layers until it is dropped
+    Datastore runtime;
+    ASSERT_TRUE(runtime.insert_property("app.server.port", std::make_shared<prop::Integer_Property>("", 9090)));
+    ASSERT_TRUE(runtime.insert_property("app.server.tls", std::make_shared<prop::Boolean_Property>("", true)));
+    ASSERT_TRUE(config.push_layer("runtime", std::move( runtime )));
+    EXPECT_EQ(config.get_or<int64_t>("app.server.port", 0), 9090);
+    EXPECT_TRUE(config.get_or<bool>("app.server.tls", false));
+    EXPECT_EQ(config.get_source("app.server.port").value(), "runtime");
+
+    ASSERT_TRUE(config.pop_layer());
+    EXPECT_EQ(config.get_or<int64_t>("app.server.port", 0), 8080);
+    EXPECT_FALSE(config.has_property("app.server.tls"));
+
+    // A reloaded layer keeps its position
+    ASSERT_TRUE(file.set<int64_t>("app.server.port", 8443));
+    ASSERT_TRUE(config.replace_layer("file", file.snapshot()));
+    EXPECT_EQ(config.get_or<int64_t>("app.server.port", 0), 8443);
+    EXPECT_EQ(config.replace_layer("env", file.snapshot()).error().code(), tmns::error::Error_Code::NOT_FOUND);
+
+    ASSERT_TRUE(config.remove_layer("file"));
+    EXPECT_EQ(config.get_or<int64_t>("app.server.port", 0), 80);
+    EXPECT_EQ(config.layer_count(), 1u);
+    EXPECT_EQ(config.get_layer("file").error().code(), tmns::error::Error_Code::NOT_FOUND);
+}
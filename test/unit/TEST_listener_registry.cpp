@@ -0,0 +1,190 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_listener_registry.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/notify/listener_registry.hpp>
+
+using namespace tmns::fcs;
+
+/***********************************/
+/*        Pattern Matching         */
+/***********************************/
+TEST( fcs_notify_Listener_Registry, pattern_matching )
+{
+    notify::Listener_Registry registry;
+    std::vector<std::string> calls;
+    auto record = [&]( const std::string& name ) {
+        return [&calls, name]( std::string_view, const prop::Property* ) { calls.push_back( name ); };
+    };
+
+    ASSERT_TRUE(registry.add("app.server.port", record("exact")));
+    ASSERT_TRUE(registry.add("app.server.*", record("prefix")));
+    ASSERT_TRUE(registry.add("app.*", record("app")));
+    ASSERT_TRUE(registry.add("**", record("all")));
+    EXPECT_EQ(registry.size(), 4u);
+
+    EXPECT_EQ(registry.dispatch("app.server.port", nullptr), 4u);
+    EXPECT_EQ(calls, (std::vector<std::string>{ "all", "app", "prefix", "exact" }));
+
+    // A prefix only matches paths strictly below it
+    calls.clear();
+    prop::Integer_Property leaf( "server", 1 );
+    EXPECT_EQ(registry.dispatch("app.server", &leaf), 2u);
+    EXPECT_EQ(calls, (std::vector<std::string>{ "all", "app" }));
+
+    calls.clear();
+    EXPECT_EQ(registry.dispatch("other.never_interned_key", nullptr), 1u);
+    EXPECT_EQ(calls, (std::vector<std::string>{ "all" }));
+
+    for( auto pattern : { "", "app.*.port", "app.**", "*", "app.ser*" } ) {
+        auto result = registry.add( pattern, record( "bad" ) );
+        ASSERT_FALSE(result) << pattern;
+        EXPECT_EQ(result.error().code(), tmns::error::Error_Code::INVALID_INPUT);
+    }
+}
+
+/***********************************/
+/*         Remove Listeners        */
+/***********************************/
+TEST( fcs_notify_Listener_Registry, remove )
+{
+    notify::Listener_Registry registry;
+    int count = 0;
+    auto first  = registry.add( "a.b.c", [&]( std::string_view, const prop::Property* ) { ++count; } ).value();
+    auto second = registry.add( "a.b.c", [&]( std::string_view, const prop::Property* ) { count += 10; } ).value();
+
+    EXPECT_TRUE(registry.remove( first ));
+    EXPECT_FALSE(registry.remove( first ));
+    registry.dispatch( "a.b.c", nullptr );
+    EXPECT_EQ(count, 10);
+
+    // Callbacks may change the registry while it dispatches
+    registry.add( "a.*", [&]( std::string_view, const prop::Property* ) { registry.remove( second ); } );
+    registry.dispatch( "a.b.c", nullptr );
+    EXPECT_EQ(count, 20);
+    registry.dispatch( "a.b.c", nullptr );
+    EXPECT_EQ(count, 20);
+    EXPECT_EQ(registry.size(), 1u);
+}
+
+/***********************************/
+/*      Many Listeners Scale       */
+/***********************************/
+TEST( fcs_notify_Listener_Registry, many_listeners )
+{
+    notify::Listener_Registry registry;
+    int hits = 0;
+    for( int i = 0; i < 20000; ++i ) {
+        registry.add( "service_" + std::to_string( i % 200 ) + ".value_" + std::to_string( i ),
+                      [&]( std::string_view, const prop::Property* ) { ++hits; } );
+    }
+
+    // Only the one matching listener is visited
+    EXPECT_EQ(registry.match("service_7.value_1207").size(), 1u);
+    EXPECT_EQ(registry.dispatch("service_7.value_1207", nullptr), 1u);
+    EXPECT_EQ(hits, 1);
+}
+
+/***********************************/
+/*     Datastore Notifications     */
+/***********************************/
+TEST( fcs_notify_Listener_Registry, datastore_notifications )
+{
+    for( auto concurrency : { Concurrency::NONE, Concurrency::SNAPSHOT } ) {
+        Datastore datastore( concurrency );
+
+        std::vector<std::string> paths;
+        std::vector<int64_t>     values;
+        auto id = datastore.add_change_listener( "app.server.*", [&]( std::string_view path, const prop::Property* property ) {
+            paths.emplace_back( path );
+            auto value = prop::typed_value_ptr<int64_t>( property );
+            values.push_back( value ? *value : -1 );
+        } ).value();
+
+        ASSERT_TRUE(datastore.insert_property("app.server.port", datastore.make_property<prop::Integer_Property>("", 80)));
+        ASSERT_TRUE(datastore.set<int64_t>("app.server.port", 8080));
+        ASSERT_TRUE(datastore.set_scalar_value("app.server.port", Value(int64_t{8081})));
+        ASSERT_TRUE(datastore.set_property("app.server.port", int64_t{8082}));
+        ASSERT_TRUE(datastore.insert_property("app.client.port", datastore.make_property<prop::Integer_Property>("", 1)));
+        EXPECT_FALSE(datastore.set<std::string>("app.server.port", "oops"));
+        ASSERT_TRUE(datastore.remove_property("app.server.port"));
+
+        EXPECT_EQ(paths.size(), 5u);
+        EXPECT_EQ(values, (std::vector<int64_t>{ 80, 8080, 8081, 8082, -1 }));
+
+        EXPECT_TRUE(datastore.remove_change_listener( id ));
+        ASSERT_TRUE(datastore.insert_property("app.server.port", datastore.make_property<prop::Integer_Property>("", 80)));
+        EXPECT_EQ(paths.size(), 5u);
+    }
+}
+
+/***********************************/
+/*        Subtree Changes          */
+/***********************************/
+TEST( fcs_notify_Listener_Registry, subtree_changes )
+{
+    for( auto concurrency : { Concurrency::NONE, Concurrency::SNAPSHOT } ) {
+        Datastore datastore( concurrency );
+        ASSERT_TRUE(datastore.insert_property("app.server.port", datastore.make_property<prop::Integer_Property>("", 80)));
+        ASSERT_TRUE(datastore.insert_property("app.server.tls.enabled", datastore.make_property<prop::Boolean_Property>("", true)));
+
+        std::vector<std::string> calls;
+        std::vector<int64_t>     ports;
+        ASSERT_TRUE(datastore.add_change_listener("app.server.port", [&]( std::string_view path, const prop::Property* property ) {
+            calls.push_back( "port:" + std::string( path ) );
+            auto value = prop::typed_value_ptr<int64_t>( property );
+            ports.push_back( value ? *value : -1 );
+        }));
+        ASSERT_TRUE(datastore.add_change_listener("app.server.*", [&]( std::string_view path, const prop::Property* ) {
+            calls.push_back( "server:" + std::string( path ) );
+        }));
+        ASSERT_TRUE(datastore.add_change_listener("app.server.tls.*", [&]( std::string_view path, const prop::Property* ) {
+            calls.push_back( "tls:" + std::string( path ) );
+        }));
+        ASSERT_TRUE(datastore.add_change_listener("app.*", [&]( std::string_view path, const prop::Property* ) {
+            calls.push_back( "app:" + std::string( path ) );
+        }));
+
+        // Removing an object notifies the listeners below it
+        ASSERT_TRUE(datastore.remove_property("app.server"));
+        std::sort( calls.begin(), calls.end() );
+        EXPECT_EQ(calls, (std::vector<std::string>{ "app:app.server", "port:app.server.port",
+                                                    "server:app.server", "tls:app.server.tls" }));
+        EXPECT_EQ(ports, (std::vector<int64_t>{ -1 }));
+
+        // Inserting one hands each listener its property in the new subtree
+        calls.clear();
+        auto server = datastore.make_property<prop::Object_Property>( "" );
+        ASSERT_TRUE(server->add_property(datastore.make_property<prop::Integer_Property>("port", 443)));
+        ASSERT_TRUE(datastore.insert_property("app.server", server));
+        EXPECT_EQ(calls.size(), 4u);
+        EXPECT_EQ(ports, (std::vector<int64_t>{ -1, 443 }));
+
+        // A batch that writes below an object it then removes reports the removal once
+        calls.clear();
+        auto transaction = datastore.transaction();
+        transaction.set<int64_t>("app.server.port", 8443).remove_property("app.server");
+        ASSERT_TRUE(transaction.commit());
+        EXPECT_EQ(calls.size(), 4u);
+        EXPECT_EQ(ports, (std::vector<int64_t>{ -1, 443, -1 }));
+    }
+}
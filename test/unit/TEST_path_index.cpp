@@ -0,0 +1,120 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_path_index.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <map>
+#include <random>
+#include <string>
+
+// Terminus Libraries
+#include <terminus/fcs/datastore.hpp>
+#include <terminus/fcs/path_index.hpp>
+#include <terminus/fcs/prop/typed_property.hpp>
+
+using namespace tmns::fcs;
+
+/***********************************/
+/*      Path Index Tests           */
+/***********************************/
+TEST( fcs_Path_Index, insert_find_erase )
+{
+    Path_Index index;
+    auto port = std::make_shared<prop::Integer_Property>("port");
+    auto host = std::make_shared<prop::String_Property>("host");
+
+    index.insert("app.database.port", port);
+    index.insert("app.database.host", host);
+    ASSERT_EQ(index.size(), 2u);
+
+    auto found = index.find("app.database.port");
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(*found, port);
+    EXPECT_EQ(index.find("app.database"), nullptr);
+
+    // Re-inserting replaces in place
+    index.insert("app.database.port", host);
+    EXPECT_EQ(index.size(), 2u);
+    EXPECT_EQ(*index.find("app.database.port"), host);
+
+    EXPECT_TRUE(index.erase("app.database.port"));
+    EXPECT_FALSE(index.erase("app.database.port"));
+    EXPECT_EQ(index.find("app.database.port"), nullptr);
+    EXPECT_NE(index.find("app.database.host"), nullptr);
+}
+
+/***********************************/
+/*      Path Index Tests           */
+/***********************************/
+TEST( fcs_Path_Index, matches_reference_map_under_churn )
+{
+    Path_Index index;
+    std::map<std::string, std::shared_ptr<prop::Property>> reference;
+    auto value = std::make_shared<prop::Integer_Property>("value");
+
+    std::mt19937 rng(42);
+    for( int i = 0; i < 20000; ++i ) {
+        std::string path = "sensor." + std::to_string(rng() % 512) + ".port";
+        if( rng() % 3 == 0 ) {
+            EXPECT_EQ(index.erase(path), reference.erase(path) == 1);
+        } else {
+            index.insert(path, value);
+            reference[path] = value;
+        }
+    }
+
+    ASSERT_EQ(index.size(), reference.size());
+    for( int i = 0; i < 512; ++i ) {
+        std::string path = "sensor." + std::to_string(i) + ".port";
+        EXPECT_EQ(index.find(path) != nullptr, reference.count(path) == 1) << path;
+    }
+}
+
+/***********************************/
+/*      Path Index Tests           */
+/***********************************/
+TEST( fcs_Path_Index, datastore_keeps_index_consistent )
+{
+    Datastore datastore;
+    auto port = std::make_shared<prop::Integer_Property>("port", 5432);
+    ASSERT_TRUE(datastore.insert_property("app.database.port", port));
+
+    // Intermediate objects are created and reachable
+    auto database = datastore.get_property("app.database");
+    ASSERT_TRUE(database);
+    EXPECT_EQ(database.value()->get_type(), schema::Property_Value_Type::OBJECT);
+    EXPECT_EQ(datastore.get_property("app.database.port").value(), port);
+
+    // Removing a subtree removes its descendants from the index
+    ASSERT_TRUE(datastore.remove_property("app.database"));
+    EXPECT_FALSE(datastore.get_property("app.database.port"));
+
+    // Replacing a subtree behind the datastore's back must not return stale nodes
+    ASSERT_TRUE(datastore.insert_property("app.database.port", port));
+    ASSERT_TRUE(datastore.get_property("app.database.port"));
+    auto app = std::static_pointer_cast<prop::Object_Property>(datastore.get_property("app").value());
+    ASSERT_TRUE(app->add_property(std::make_shared<prop::Object_Property>("database")));
+    EXPECT_FALSE(datastore.get_property("app.database.port"));
+
+    // Inserting below a leaf is a type error
+    ASSERT_TRUE(datastore.insert_property("app.database.port", port));
+    auto result = datastore.insert_property("app.database.port.bad",
+                                            std::make_shared<prop::Integer_Property>("bad"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), tmns::error::Error_Code::TYPE_MISMATCH);
+
+    datastore.clear();
+    EXPECT_FALSE(datastore.get_property("app"));
+}
@@ -14,6 +14,7 @@
 */
 
 // C++ Standard Libraries
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -330,3 +331,195 @@ TEST_F( fcs_prop_Property, path_property_basic )
     EXPECT_EQ(prop->get_type(), schema::Property_Value_Type::PATH);
     EXPECT_EQ(prop->get_type_string(), "path");
 }
+
+/*****************************************/
+/*      Object Child Storage Tests       */
+/*****************************************/
+TEST_F( fcs_prop_Property, object_children_small_and_large )
+{
+    auto obj = std::make_shared<prop::Object_Property>("sensors");
+
+    // Grow past the linear-scan limit, inserting out of order
+    for( int i = 39; i >= 0; --i ) {
+        auto key = "sensor_" + std::string(i < 10 ? "0" : "") + std::to_string(i);
+        ASSERT_TRUE(obj->add_property(std::make_shared<prop::Integer_Property>(key, i)));
+
+        // Every child stays reachable at every size
+        for( int j = 39; j >= i; --j ) {
+            auto other = "sensor_" + std::string(j < 10 ? "0" : "") + std::to_string(j);
+            ASSERT_TRUE(obj->get_property(other)) << other << " missing at size " << obj->child_count();
+        }
+    }
+    ASSERT_EQ(obj->child_count(), 40u);
+
+    // Iteration is in atom order with no copies
+    size_t index = 0;
+    obj->for_each_child( [&]( const std::string& key, const std::shared_ptr<prop::Property>& child ) {
+        if( index > 0 ) {
+            EXPECT_LT(obj->child_atom(index - 1), obj->child_atom(index));
+        }
+        EXPECT_EQ(child->get_key(), key);
+        EXPECT_EQ(obj->child_key(index), key);
+        ++index;
+    });
+
+    // The key copy is alphabetical
+    auto keys = obj->get_child_keys();
+    ASSERT_EQ(keys.size(), 40u);
+    EXPECT_EQ(keys.front(), "sensor_00");
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    // Replacement keeps a single entry
+    auto replacement = std::make_shared<prop::Integer_Property>("sensor_07", 700);
+    ASSERT_TRUE(obj->add_property(replacement));
+    EXPECT_EQ(obj->child_count(), 40u);
+    EXPECT_EQ(obj->get_property("sensor_07").value(), replacement);
+
+    // Shrink back below the limit
+    for( int i = 0; i < 30; ++i ) {
+        auto key = "sensor_" + std::string(i < 10 ? "0" : "") + std::to_string(i);
+        ASSERT_TRUE(obj->remove_property(key));
+        EXPECT_FALSE(obj->get_property(key));
+    }
+    EXPECT_EQ(obj->child_count(), 10u);
+    EXPECT_TRUE(obj->get_property("sensor_35"));
+    EXPECT_FALSE(obj->remove_property("sensor_00"));
+}
+
+/*****************************************/
+/*      Scalar Value Interface Tests     */
+/*****************************************/
+TEST_F( fcs_prop_Property, scalar_value_interface )
+{
+    auto port = std::make_shared<prop::Integer_Property>("port", 80);
+
+    auto read = port->get_scalar_value();
+    ASSERT_TRUE(read);
+    EXPECT_EQ(value_type(read.value()), schema::Property_Value_Type::INTEGER);
+    EXPECT_EQ(std::get<int64_t>(read.value()), 80);
+
+    ASSERT_TRUE(port->set_scalar_value(Value(int64_t{ 8080 })));
+    EXPECT_EQ(port->get_typed_value().value(), 8080);
+
+    // Mismatched alternatives are reported, not thrown
+    auto mismatch = port->set_scalar_value(Value(std::string("8080")));
+    ASSERT_FALSE(mismatch);
+    EXPECT_EQ(mismatch.error().code(), tmns::error::Error_Code::TYPE_MISMATCH);
+    EXPECT_FALSE(port->set_value(std::any(3.5)));
+    EXPECT_FALSE(port->set_value(std::any()));
+
+    // Containers do not hold scalars
+    auto obj = std::make_shared<prop::Object_Property>("app");
+    EXPECT_FALSE(obj->get_scalar_value());
+    EXPECT_FALSE(obj->set_scalar_value(Value(true)));
+
+    // The any shim round-trips through Value
+    auto converted = value_from_any(value_to_any(Value(std::filesystem::path("/etc/app.toml"))));
+    ASSERT_TRUE(converted);
+    EXPECT_EQ(std::get<std::filesystem::path>(*converted), std::filesystem::path("/etc/app.toml"));
+    EXPECT_FALSE(value_from_any(std::any(42)));
+
+    // Datastore access by path
+    Datastore datastore;
+    ASSERT_TRUE(datastore.insert_property("server.port", port));
+    ASSERT_TRUE(datastore.set_scalar_value("server.port", Value(int64_t{ 9090 })));
+    EXPECT_EQ(std::get<int64_t>(datastore.get_scalar_value("server.port").value()), 9090);
+    EXPECT_FALSE(datastore.get_scalar_value("server"));
+}
+
+/*******************************************/
+/*     Test copy-on-write node cloning     */
+/*******************************************/
+TEST_F( fcs_prop_Property, clone_node_shares_children )
+{
+    auto app  = std::make_shared<prop::Object_Property>("app");
+    auto name = std::make_shared<prop::String_Property>("name", "demo");
+    auto db   = std::make_shared<prop::Object_Property>("db");
+    ASSERT_TRUE(db->add_property(std::make_shared<prop::Integer_Property>("port", 5432)));
+    ASSERT_TRUE(app->add_property(name));
+    ASSERT_TRUE(app->add_property(db));
+
+    // A clone shares its children and carries the same aggregates
+    constexpr uint64_t EDIT = 42;
+    auto copy = std::static_pointer_cast<prop::Object_Property>(app->clone_node(nullptr, EDIT));
+    EXPECT_EQ(copy->get_edit(), EDIT);
+    EXPECT_EQ(app->get_edit(), 0u);
+    EXPECT_EQ(copy->get_key(), "app");
+    EXPECT_EQ(copy->get_property("name").value(), name);
+    EXPECT_EQ(copy->get_subtree_stats().node_count, app->get_subtree_stats().node_count);
+    EXPECT_EQ(copy->get_subtree_stats().bytes, app->get_subtree_stats().bytes);
+
+    // Writing through the clone copies the child and leaves the original alone
+    auto child = copy->writable_child("db", nullptr, EDIT);
+    ASSERT_NE(child, nullptr);
+    EXPECT_NE(child->get(), db.get());
+    EXPECT_EQ(copy->writable_child("db", nullptr, EDIT), child);
+    EXPECT_EQ(copy->writable_child("missing", nullptr, EDIT), nullptr);
+
+    auto port = static_cast<prop::Object_Property&>(**child).writable_child("port", nullptr, EDIT);
+    ASSERT_NE(port, nullptr);
+    EXPECT_FALSE((*port)->set_scalar_value(Value(std::string("6543"))));
+    ASSERT_TRUE((*port)->set_scalar_value(Value(int64_t{ 6543 })));
+
+    auto original = app->resolve_path("db.port");
+    ASSERT_TRUE(original);
+    EXPECT_EQ(std::get<int64_t>(original.value()->get_scalar_value().value()), 5432);
+    EXPECT_EQ(std::get<int64_t>(copy->resolve_path("db.port").value()->get_scalar_value().value()), 6543);
+}
+
+/*******************************************/
+/*      Test incremental content hashes    */
+/*******************************************/
+TEST_F( fcs_prop_Property, content_hash_tracks_changes )
+{
+    auto build = []( int64_t port, const std::vector<int64_t>& items ) {
+        auto root = std::make_shared<prop::Object_Property>("root");
+        auto db   = std::make_shared<prop::Object_Property>("db");
+        auto list = std::make_shared<prop::Array_Property>("list");
+        EXPECT_TRUE(root->add_property(db));
+        EXPECT_TRUE(db->add_property(std::make_shared<prop::Integer_Property>("port", port)));
+        EXPECT_TRUE(db->add_property(std::make_shared<prop::String_Property>("host", "localhost")));
+        EXPECT_TRUE(root->add_property(list));
+        for( auto item : items ) {
+            EXPECT_TRUE(list->add_item(std::make_shared<prop::Integer_Property>("", item)));
+        }
+        return root;
+    };
+
+    // Equal content hashes equally, whatever the insertion order or key atoms
+    auto tree = build( 5432, { 1, 2, 3 } );
+    EXPECT_EQ(tree->get_content_hash(), build( 5432, { 1, 2, 3 } )->get_content_hash());
+    EXPECT_NE(tree->get_content_hash(), build( 5433, { 1, 2, 3 } )->get_content_hash());
+    EXPECT_NE(tree->get_content_hash(), build( 5432, { 2, 1, 3 } )->get_content_hash());
+    EXPECT_NE(prop::Integer_Property("", 1).get_content_hash(), prop::Boolean_Property("", true).get_content_hash());
+
+    // Updates reach the root incrementally and match a fresh build
+    auto port = tree->resolve_path("db.port").value();
+    ASSERT_TRUE(port->set_scalar_value(Value(int64_t{ 6543 })));
+    EXPECT_EQ(tree->get_content_hash(), build( 6543, { 1, 2, 3 } )->get_content_hash());
+    auto list = std::static_pointer_cast<prop::Array_Property>(tree->resolve_path("list").value());
+    ASSERT_TRUE(list->remove_item(1));
+    EXPECT_EQ(tree->get_content_hash(), build( 6543, { 1, 3 } )->get_content_hash());
+    ASSERT_TRUE(list->item_at(0)->set_scalar_value(Value(int64_t{ 4 })));
+    EXPECT_EQ(tree->get_content_hash(), build( 6543, { 4, 3 } )->get_content_hash());
+    ASSERT_TRUE(list->item_at(1)->set_scalar_value(Value(int64_t{ 5 })));
+    EXPECT_EQ(tree->get_content_hash(), build( 6543, { 4, 5 } )->get_content_hash());
+    ASSERT_TRUE(list->item_at(1)->set_scalar_value(Value(int64_t{ 3 })));
+    EXPECT_EQ(tree->get_content_hash(), build( 6543, { 4, 3 } )->get_content_hash());
+
+    auto db = std::static_pointer_cast<prop::Object_Property>(tree->resolve_path("db").value());
+    ASSERT_TRUE(db->remove_property("host"));
+    ASSERT_TRUE(db->add_property(std::make_shared<prop::String_Property>("host", "localhost")));
+    EXPECT_EQ(tree->get_content_hash(), build( 6543, { 4, 3 } )->get_content_hash());
+
+    // A copy-on-write clone keeps the hash until it is written
+    constexpr uint64_t EDIT = 7;
+    const auto before = tree->get_content_hash();
+    auto copy = std::static_pointer_cast<prop::Object_Property>(tree->clone_node(nullptr, EDIT));
+    EXPECT_EQ(copy->get_content_hash(), before);
+    auto copied_db = copy->writable_child("db", nullptr, EDIT);
+    auto copied_port = static_cast<prop::Object_Property&>(**copied_db).writable_child("port", nullptr, EDIT);
+    ASSERT_TRUE((*copied_port)->set_scalar_value(Value(int64_t{ 5432 })));
+    EXPECT_EQ(copy->get_content_hash(), build( 5432, { 4, 3 } )->get_content_hash());
+    EXPECT_EQ(tree->get_content_hash(), before);
+}
@@ -23,6 +23,9 @@
 #include <terminus/fcs/datastore.hpp>
 #include <terminus/fcs/schema/schema.hpp>
 #include <terminus/fcs/schema/builder.hpp>
+#include <terminus/fcs/schema/custom_constraint.hpp>
+#include <terminus/fcs/schema/enum_constraint.hpp>
+#include <terminus/fcs/schema/range_constraint.hpp>
 #include <terminus/fcs/prop/typed_property.hpp>
 
 using namespace tmns::fcs;
@@ -262,3 +265,44 @@ TEST_F( fcs_schema_Schema, schema_with_range_constraints )
     auto schema_result = datastore->set_schema("", *schema);
     ASSERT_TRUE(schema_result) << "Failed to apply range constraint schema: " << schema_result.error().message();
 }
+
+/****************************************************/
+/*      Value-Based Constraint Validation           */
+/****************************************************/
+TEST_F( fcs_schema_Schema, validate_scalar_values )
+{
+    schema::Schema port_schema( schema::Property_Value_Type::INTEGER );
+    port_schema.add_constraint( std::make_shared<Range_Constraint<int64_t>>( 1, 65535 ) );
+
+    EXPECT_TRUE(port_schema.validate_value( Value( int64_t{ 8080 } ) ));
+    EXPECT_FALSE(port_schema.validate_value( Value( int64_t{ 70000 } ) ));
+    EXPECT_FALSE(port_schema.validate_value( Value( std::string( "8080" ) ) ));
+
+    // The std::any shim reaches the same constraint
+    EXPECT_TRUE(port_schema.validate( std::any( int64_t{ 22 } ) ));
+    EXPECT_FALSE(port_schema.validate( std::any( int64_t{ 0 } ) ));
+
+    schema::Schema level_schema( schema::Property_Value_Type::STRING );
+    level_schema.add_constraint( std::make_shared<schema::Enum_Constraint>( std::vector<std::string>{ "debug", "info" } ) );
+    EXPECT_TRUE(level_schema.validate_value( Value( std::string( "info" ) ) ));
+    EXPECT_FALSE(level_schema.validate_value( Value( std::string( "trace" ) ) ));
+
+    // Custom constraints written against std::any still see scalar values
+    schema::Schema even_schema( schema::Property_Value_Type::INTEGER );
+    even_schema.add_constraint( std::make_shared<schema::Custom_Constraint>(
+        []( const std::any& value ) -> tmns::Result<void> {
+            if( std::any_cast<int64_t>( value ) % 2 != 0 ) {
+                return tmns::outcome::fail( tmns::error::Error_Code::INVALID_INPUT, "odd" );
+            }
+            return tmns::outcome::ok();
+        }, "Value must be even" ) );
+    EXPECT_TRUE(even_schema.validate_value( Value( int64_t{ 4 } ) ));
+    EXPECT_FALSE(even_schema.validate_value( Value( int64_t{ 5 } ) ));
+
+    // Properties validate through the Value path
+    auto port = std::make_shared<prop::Integer_Property>( "port", 70000 );
+    port->set_schema( port_schema );
+    EXPECT_FALSE(port->validate());
+    ASSERT_TRUE(port->set_scalar_value( Value( int64_t{ 443 } ) ));
+    EXPECT_TRUE(port->validate());
+}
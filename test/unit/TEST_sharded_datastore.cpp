@@ -0,0 +1,106 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_sharded_datastore.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/fcs/sharded_datastore.hpp>
+
+using namespace tmns::fcs;
+
+/***********************************/
+/*        Routing And Access       */
+/***********************************/
+TEST( fcs_Sharded_Datastore, routing )
+{
+    Sharded_Datastore datastore( 8, 2 );
+
+    ASSERT_TRUE(datastore.insert_property("app.database.port", std::make_shared<prop::Integer_Property>("", 5432)));
+    ASSERT_TRUE(datastore.insert_property("app.server.host", std::make_shared<prop::String_Property>("", "localhost")));
+
+    // Routing only looks at the first two components
+    EXPECT_EQ(datastore.shard_index("app.database.port").value(), datastore.shard_index("app.database.user").value());
+
+    EXPECT_TRUE(datastore.set<int64_t>("app.database.port", 6543));
+    EXPECT_EQ(datastore.get_or<int64_t>("app.database.port", 0), 6543);
+    EXPECT_EQ(datastore.get_or<std::string>("app.server.host", ""), "localhost");
+    EXPECT_TRUE(datastore.has_property("app.server.host"));
+    EXPECT_FALSE(datastore.has_property("app.server.port"));
+
+    // Paths shorter than the key depth cannot be routed
+    auto result = datastore.insert_property("app", std::make_shared<prop::Integer_Property>("", 1));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), tmns::error::Error_Code::INVALID_INPUT);
+    EXPECT_FALSE(datastore.has_property("app"));
+
+    ASSERT_TRUE(datastore.remove_property("app.server.host"));
+    EXPECT_FALSE(datastore.has_property("app.server.host"));
+}
+
+/***********************************/
+/*        Consistent Snapshot      */
+/***********************************/
+TEST( fcs_Sharded_Datastore, consistent_snapshot )
+{
+    Sharded_Datastore datastore( 4 );
+    const std::vector<std::string> paths = { "alpha.value", "bravo.value", "charlie.value", "delta.value" };
+    for( const auto& path : paths ) {
+        ASSERT_TRUE(datastore.insert_property(path, std::make_shared<prop::Integer_Property>("", 0)));
+    }
+
+    auto before = datastore.snapshot();
+    ASSERT_TRUE(datastore.set<int64_t>("alpha.value", 1));
+    EXPECT_EQ(before.get_or<int64_t>("alpha.value", -1), 0);
+    EXPECT_EQ(datastore.snapshot().get_or<int64_t>("alpha.value", -1), 1);
+    EXPECT_EQ(datastore.size(), 8u);
+
+    // Pick two subsystems that live in different shards
+    std::string first = "alpha.value";
+    std::string second;
+    for( const auto& path : paths ) {
+        if( datastore.shard_index( path ).value() != datastore.shard_index( first ).value() ) {
+            second = path;
+            break;
+        }
+    }
+    ASSERT_FALSE(second.empty());
+
+    // The writer always updates the first shard before the second, so a
+    // consistent cut never shows the second ahead of the first.
+    std::atomic<bool> done{ false };
+    std::thread writer( [&]() {
+        for( int64_t i = 1; i <= 500; ++i ) {
+            datastore.set<int64_t>( first, i );
+            datastore.set<int64_t>( second, i );
+        }
+        done = true;
+    } );
+
+    while( !done.load() ) {
+        auto cut = datastore.snapshot();
+        const auto second_value = cut.get_or<int64_t>( second, -1 );
+        const auto first_value  = cut.get_or<int64_t>( first, -1 );
+        EXPECT_LE(second_value, first_value);
+        EXPECT_LE(first_value - second_value, 1);
+    }
+    writer.join();
+    EXPECT_EQ(datastore.snapshot().get_or<int64_t>(second, 0), 500);
+}